@@ -51,6 +51,8 @@
 #include "unicodedata.h"
 #include "main.h"
 #include "argvalues.h"
+#include "profile.h"
+#include "passtrace.h"
 #include "version.h"
 
 #include "listobj.h"
@@ -90,6 +92,7 @@ bool fixeddig, constcreated;
 uint32_t outputeor = 0; /* EOR value for final output (usually 0, unless changed by .eor) */
 bool referenceit = true;
 const struct cpu_s *current_cpu;
+bool signal_received = false;
 static unsigned int err_msg_char_note_once;
 static unsigned int err_msg_enc_string_expected_once;
 static unsigned int err_msg_cpu_string_expected_once;
@@ -192,7 +195,7 @@ static struct waitfor_s {
 
 struct star_s *star_tree = NULL;
 
-static const char *const command[] = { /* must be sorted, first char is the ID */
+static const char *const command[] = { /* first char is the ID, must be in command_hash as well */
     "\x08" "addr",
     "\x22" "al",
     "\x34" "align",
@@ -327,6 +330,52 @@ static const char *const command[] = { /* must be sorted, first char is the ID *
     "\x23" "xs",
 };
 
+/* perfect hash of the names above, index + 1 */
+#define COMMAND_HASH_BITS 9
+#define COMMAND_HASH_MUL 0x447c1599U
+static const uint8_t command_hash[1 << COMMAND_HASH_BITS] = {
+    0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 10, 0,
+    0, 35, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 17, 0, 131, 110,
+    27, 104, 0, 28, 0, 0, 0, 18, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 94, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 0, 0, 112, 0, 0,
+    96, 25, 0, 102, 0, 99, 13, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    41, 0, 0, 126, 0, 0, 0, 0, 132, 78, 0, 0, 0, 73, 0, 33, 116, 0, 64, 0, 40,
+    109, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 71, 0, 0, 91, 45, 0, 0, 0, 69, 32, 0,
+    0, 0, 51, 0, 123, 0, 67, 90, 0, 0, 0, 0, 0, 88, 0, 103, 63, 0, 0, 0, 129,
+    0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 34, 0, 0, 8, 0, 111, 44, 0, 0, 0, 125,
+    92, 119, 0, 0, 0, 0, 101, 52, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 106, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 74, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 72, 15, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 42, 37, 128, 0, 0, 0, 0, 100,
+    0, 4, 0, 82, 0, 0, 0, 89, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 84, 0,
+    0, 0, 77, 0, 0, 0, 0, 0, 118, 120, 0, 0, 76, 0, 0, 0, 0, 0, 22, 43, 0, 0,
+    0, 39, 47, 0, 121, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 87, 21, 70, 0, 95, 0, 7, 0, 0, 0, 30, 75, 0, 58, 0, 0,
+    36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 24, 0, 0, 105, 0, 0, 0, 0,
+    0, 0, 127, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14,
+    0, 61, 62, 122, 46, 0, 9, 0, 0, 12, 0, 57, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0,
+    0, 0, 0, 98, 0, 0, 1, 0, 0, 0, 5, 0, 48, 0, 49, 0, 0, 0, 68, 0, 0, 0, 0, 0,
+    0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 107, 0, 65, 11, 0, 0, 0, 0, 56, 0, 0, 93,
+    0, 0, 81, 0, 0, 0, 0, 0, 0, 115, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 19,
+    0, 0, 0, 16, 97, 0, 0, 114, 0, 113, 0, 0, 0, 0
+};
+
+#ifdef DEBUG
+static void check_command_hash(void) {
+    unsigned int i;
+    for (i = 0; i < lenof(command); i++) {
+        const uint8_t *s = (const uint8_t *)command[i] + 1;
+        uint32_t h = 0;
+        while (*s != 0) {
+            h *= 7;
+            h ^= *s++;
+        }
+        if (command_hash[(uint32_t)(h * COMMAND_HASH_MUL) >> (32 - COMMAND_HASH_BITS)] != i + 1) {
+            fprintf(stderr, "command .%s is not in its hash slot\n", command[i] + 1);
+        }
+    }
+}
+#endif
+
 typedef enum Command_types {
     CMD_TEXT = 0, CMD_PTEXT, CMD_SHIFT, CMD_SHIFTL, CMD_NULL, CMD_BYTE, CMD_CHAR,
     CMD_RTA, CMD_ADDR, CMD_SINT, CMD_WORD, CMD_LINT, CMD_LONG, CMD_DINT,
@@ -351,6 +400,9 @@ typedef enum Command_types {
 
 /* --------------------------------------------------------------------------- */
 static void compile_init(const char *name) {
+#ifdef DEBUG
+    check_command_hash();
+#endif
     err_init(name);
     init_type();
     objects_init();
@@ -360,6 +412,7 @@ static void compile_init(const char *name) {
     init_eval();
     init_ternary();
     init_opt_bit();
+    init_instruction();
     waitfors = NULL;
     waitfor_p = 0;
     waitfor_len = 0;
@@ -371,6 +424,7 @@ static void compile_init(const char *name) {
 }
 
 static void compile_destroy(void) {
+    listing_destroy();
     destroy_lastlb();
     destroy_eval();
     destroy_argvalues();
@@ -389,6 +443,8 @@ static void compile_destroy(void) {
     if (unfkc(NULL, NULL, 0)) {}
     str_cfcpy(NULL, NULL);
     free_macro();
+    profile_destroy();
+    pass_trace_destroy();
     free(waitfors);
 }
 
@@ -425,11 +481,12 @@ static void set_size(Label *label, address_t size, Memblocks *mem, address_t oad
         Code *code = Code(label->value);
         size &= all_mem2;
         if (code->size != size) {
-            code->size = size;
             if (code->pass != 0) {
                 if (fixeddig && pass > max_pass) err_msg_cant_calculate(&label->name, &label->epoint);
+                if (pass_tracing) pass_trace_address(&label->name, &label->epoint, "size", code->size, size);
                 fixeddig = false;
             }
+            code->size = size;
         }
         code->pass = pass;
         if (code->memblocks != mem) {
@@ -448,11 +505,12 @@ static address_t alignblk_set_size(Label *label) {
     if (alignblk->v.obj != ALIGNBLK_OBJ) return 0;
     size = (current_address->address - alignblk->addr) & all_mem2;
     if (alignblk->size != size) {
-        alignblk->size = size;
         if (alignblk->pass != 0) {
             if (fixeddig && pass > max_pass) err_msg_cant_calculate(&label->name, &label->epoint);
+            if (pass_tracing) pass_trace_address(&label->name, &label->epoint, "size", alignblk->size, size);
             fixeddig = false;
         }
+        alignblk->size = size;
     }
     alignblk->pass = pass;
     val_destroy(Obj(label));
@@ -557,12 +615,10 @@ FAST_CALL uint8_t *pokealloc(address_t db, linepos_t epoint) {
 
 /* --------------------------------------------------------------------------- */
 static int get_command(void) {
-    enum { MASK = 255 };
-    static uint8_t hash[MASK + 1];
-    unsigned int no, also, felso, elozo;
-    const uint8_t *label;
+    const uint8_t *label, *cmd2;
     uint8_t tmp[13];
-    unsigned int ln, h;
+    unsigned int ln, i;
+    uint32_t h;
     lpoint.pos++;
     label = pline + lpoint.pos;
     for (ln = h = 0; ln < sizeof tmp; ln++) {
@@ -587,37 +643,14 @@ static int get_command(void) {
         } else if (label[ln] <= '9' || (uint8_t)(label[ln] - 'A') <= ('Z' - 'A') || label[ln] == '_') return lenof(command);
     }
     tmp[ln] = 0;
-    for (;;) {
-        const uint8_t *cmd2;
-        uint8_t h2 = hash[h & MASK];
-        if (h2 == 0) break;
-        cmd2 = (const uint8_t *)command[h2 - 1] + 1;
-        if (tmp[0] == cmd2[0]) {
-            unsigned int i;
-            for (i = 1; tmp[i] == cmd2[i]; i++) {
-                if (tmp[i] != 0) continue;
-                lpoint.pos += ln;
-                return cmd2[-1];
-            }
-        }
-        h += 5;
+    i = command_hash[(uint32_t)(h * COMMAND_HASH_MUL) >> (32 - COMMAND_HASH_BITS)];
+    if (i == 0) return lenof(command);
+    cmd2 = (const uint8_t *)command[i - 1] + 1;
+    for (i = 0; tmp[i] == cmd2[i]; i++) {
+        if (tmp[i] != 0) continue;
+        lpoint.pos += ln;
+        return cmd2[-1];
     }
-
-    also = 0;
-    felso = lenof(command);
-    no = lenof(command)/2;
-    do {
-        const uint8_t *cmd2 = (const uint8_t *)command[no] + 1;
-        unsigned int i;
-        for (i = 0; tmp[i] == cmd2[i]; i++) {
-            if (tmp[i] != 0) continue;
-            lpoint.pos += i;
-            hash[h & MASK] = (uint8_t)(no + 1);
-            return cmd2[-1];
-        }
-        elozo = no;
-        no = ((tmp[i] >= cmd2[i]) ? (felso + (also = no)) : (also + (felso = no)))/2;
-    } while (elozo != no);
     return lenof(command);
 }
 
@@ -632,14 +665,21 @@ static void set_cpumode(const struct cpu_s *cpumode) {
     if (registerobj_createnames(cpumode->registers)) constcreated = true;
 }
 
+static void label_created(const Label *label, linepos_t epoint) {
+    if (pass > max_pass) err_msg_cant_calculate(&label->name, epoint);
+    if (pass_tracing) pass_trace_note(&label->name, epoint, "created");
+    constcreated = true;
+}
+
 static void const_assign(Label *label, Obj *val) {
     label->defpass = pass;
-    if (fixeddig && label->usepass >= pass) {
+    if ((fixeddig || pass_tracing) && label->usepass >= pass) {
         if (val->obj->same(val, label->value)) {
             val_destroy(val);
             return;
         }
-        if (pass > max_pass) err_msg_cant_calculate(&label->name, &label->epoint);
+        if (fixeddig && pass > max_pass) err_msg_cant_calculate(&label->name, &label->epoint);
+        if (pass_tracing) pass_trace_value(&label->name, &label->epoint, label->value, val);
         fixeddig = false;
     }
     val_destroy(label->value);
@@ -995,20 +1035,22 @@ static void memfill(address_t db, const struct values_s *vs) {
             trec.gaps += db; /* gap shortcut */
         } else {
             address_t offs = 0;
+            uint8_t buff[256];
             if (trec.p > 0) textrecursion_flush(&trec);
             while (db != 0) { /* pattern repeat */
-                int ch;
-                db--;
-                ch = read_mem(current_address->mem, oaddr, membp, offs);
-                if (ch < 0) {
-                    if (trec.p > 0) textrecursion_flush(&trec);
+                address_t ln = trec.sum - offs;
+                if (ln > db) ln = db;
+                if (ln > sizeof buff) ln = sizeof buff;
+                ln = copy_mem(buff, current_address->mem, oaddr, membp, offs, ln);
+                if (ln == 0) {
                     trec.gaps++;
+                    ln = 1;
                 } else {
                     if (trec.gaps > 0) textrecursion_gaps(&trec);
-                    else if (trec.p >= sizeof trec.buff) textrecursion_flush(&trec);
-                    trec.buff[trec.p++] = (uint8_t)ch;
+                    memcpy(pokealloc(ln, trec.epoint2), buff, ln);
                 }
-                offs++;
+                db -= ln;
+                offs += ln;
                 if (offs >= trec.sum) offs = 0;
             }
         }
@@ -1252,6 +1294,7 @@ static bool section_start(linepos_t epoint) {
         if (tmp->usepass != 0 && tmp->usepass >= pass - 1) err_msg_not_defined(&sectionname, &opoint);
         else {
             if (fixeddig && pass > max_pass) err_msg_cant_calculate(&sectionname, epoint);
+            if (pass_tracing) pass_trace_note(&sectionname, epoint, "section defined after use");
             fixeddig = false;
         }
         tmp->defpass = (uint8_t)(pass - 1);
@@ -1466,21 +1509,23 @@ static void update_code(const Label *newlabel, Code *code) {
     if (current_address->bankwarn) {err_msg_pc_bank(&newlabel->epoint);current_address->bankwarn = false;}
     tmp = current_address->l_address_val;
     if (!tmp->obj->same(tmp, code->typ)) {
-        val_destroy(code->typ); code->typ = val_reference(tmp);
         if (newlabel->usepass >= pass) {
             if (fixeddig && pass > max_pass) err_msg_cant_calculate(&newlabel->name, &newlabel->epoint);
+            if (pass_tracing) pass_trace_value(&newlabel->name, &newlabel->epoint, code->typ, tmp);
             fixeddig = false;
         }
+        val_destroy(code->typ); code->typ = val_reference(tmp);
     }
     if (code->addr != star || code->required != current_section->required || code->conflicts != current_section->conflicts || code->offs != 0) {
-        code->addr = star;
-        code->required = current_section->required;
-        code->conflicts = current_section->conflicts;
-        code->offs = 0;
         if (newlabel->usepass >= pass) {
             if (fixeddig && pass > max_pass) err_msg_cant_calculate(&newlabel->name, &newlabel->epoint);
+            if (pass_tracing) pass_trace_address(&newlabel->name, &newlabel->epoint, "address", code->addr, star);
             fixeddig = false;
         }
+        code->addr = star;
+        code->required = current_section->required;
+        code->conflicts = current_section->conflicts;
+        code->offs = 0;
     }
     code->names->backr = code->names->forwr = 0;
     code->names->file_list = current_file_list;
@@ -1530,11 +1575,12 @@ static MUST_CHECK Obj *tuple_scope(const Label *newlabel, Obj **o) {
     pop_context();
     size = (current_address->address - oaddr) & all_mem2;
     if (code->size != size) {
-        code->size = size;
         if (code->pass != 0) {
             if (fixeddig && pass > max_pass) err_msg_cant_calculate(&newlabel->name, &newlabel->epoint);
+            if (pass_tracing) pass_trace_address(&newlabel->name, &newlabel->epoint, "size", code->size, size);
             fixeddig = false;
         }
+        code->size = size;
     }
     code->pass = pass;
     if (code->memblocks != current_address->mem) {
@@ -1766,6 +1812,7 @@ static size_t for_command(const Label *newlabel, List *lst, linepos_t epoint) {
     s = new_star(vline); stree_old = star_tree;
     if (s->pass != 0 && s->addr != star) {
         if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+        if (pass_tracing) pass_trace_address(NULL, epoint, "address", s->addr, star);
         fixeddig = false;
     }
     s->addr = star;
@@ -2086,6 +2133,7 @@ static size_t rept_command(const Label *newlabel, List *lst, linepos_t epoint) {
 
         if (s->pass != 0 && s->addr != star) {
             if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+            if (pass_tracing) pass_trace_address(NULL, epoint, "address", s->addr, star);
             fixeddig = false;
         }
         s->addr = star;
@@ -2135,6 +2183,7 @@ static size_t while_command(const Label *newlabel, List *lst, linepos_t epoint)
     s = new_star(vline); stree_old = star_tree;
     if (s->pass != 0 && s->addr != star) {
         if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+        if (pass_tracing) pass_trace_address(NULL, epoint, "address", s->addr, star);
         fixeddig = false;
     }
     s->addr = star;
@@ -2456,6 +2505,22 @@ static MUST_CHECK Label *new_anonlabel(Namespace *context) {
     return new_label(&tmpname, context, strength, current_file_list);
 }
 
+/* Directives which have no effect outside of the function they're used in */
+static bool function_command(int prm) {
+    switch (prm) {
+    case CMD_IF: case CMD_IFEQ: case CMD_IFNE: case CMD_IFPL: case CMD_IFMI:
+    case CMD_ELSE: case CMD_ELSIF: case CMD_FI:
+    case CMD_SWITCH: case CMD_CASE: case CMD_DEFAULT: case CMD_ENDSWITCH:
+    case CMD_FOR: case CMD_NEXT: case CMD_ENDFOR: case CMD_REPT: case CMD_ENDREPT:
+    case CMD_WHILE: case CMD_ENDWHILE: case CMD_BREAK: case CMD_CONTINUE:
+    case CMD_BREAKIF: case CMD_CONTINUEIF:
+    case CMD_COMMENT: case CMD_ENDC: case CMD_ENDF:
+        return true;
+    default:
+        return false;
+    }
+}
+
 MUST_CHECK Obj *compile(void)
 {
     int wht;
@@ -2570,6 +2635,7 @@ MUST_CHECK Obj *compile(void)
                 }
                 ignore();wht = here();
                 if (error) {epoint = lpoint; goto jn;} /* skip things if needed */
+                if (mycontext != current_context || labelname.data[0] == '*' || labelname.data == (const uint8_t *)&anonsymbol) function_impure(PURITY_NONE);
                 if (labelname.len > 1 && labelname.data[0] == '_' && labelname.data[1] == '_') {err_msg2(ERROR_RESERVED_LABL, &labelname, &epoint); goto breakerr;}
                 while (wht != 0 && !arguments.tasmcomp) {
                     bool error2;
@@ -2795,10 +2861,7 @@ MUST_CHECK Obj *compile(void)
                                 err_msg_double_defined(label, &labelname, &epoint);
                             } else {
                                 if (label->fwpass == pass) fwcount--;
-                                if (!constcreated && label->defpass != pass - 1) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated && label->defpass != pass - 1) label_created(label, &epoint);
                                 label->constant = true;
                                 label->owner = false;
                                 if (label->file_list != current_file_list) {
@@ -2809,10 +2872,7 @@ MUST_CHECK Obj *compile(void)
                                 const_assign(label, val);
                             }
                         } else {
-                            if (!constcreated) {
-                                if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                constcreated = true;
-                            }
+                            if (!constcreated) label_created(label, &epoint);
                             label->constant = true;
                             label->owner = false;
                             label->value = val;
@@ -2830,6 +2890,7 @@ MUST_CHECK Obj *compile(void)
                         err_msg2(ERROR_RESERVED_LABL, &labelname, &epoint);
                         newlabel = NULL; epoint = cmdpoint; goto as_command;
                     }
+                    if (prm != CMD_VAR) function_impure(PURITY_NONE);
                     switch (prm) {
                     case CMD_VAR: /* variable */
                         {
@@ -2899,10 +2960,7 @@ MUST_CHECK Obj *compile(void)
                                     err_msg_double_defined(label, &labelname, &epoint);
                                 } else {
                                     if (label->fwpass == pass) fwcount--;
-                                    if (!constcreated && label->defpass != pass - 1) {
-                                        if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                        constcreated = true;
-                                    }
+                                    if (!constcreated && label->defpass != pass - 1) label_created(label, &epoint);
                                     label->constant = true;
                                     label->owner = true;
                                     if (label->file_list != current_file_list) {
@@ -2913,10 +2971,7 @@ MUST_CHECK Obj *compile(void)
                                     const_assign(label, Obj(lbl));
                                 }
                             } else {
-                                if (!constcreated) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated) label_created(label, &epoint);
                                 label->constant = true;
                                 label->owner = true;
                                 label->value = Obj(lbl);
@@ -2937,18 +2992,12 @@ MUST_CHECK Obj *compile(void)
                                     goto as_command;
                                 }
                                 if (label->fwpass == pass) fwcount--;
-                                if (!constcreated && label->defpass != pass - 1) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated && label->defpass != pass - 1) label_created(label, &epoint);
                                 if (label->file_list != current_file_list) {
                                     label_move(label, &labelname, current_file_list);
                                 }
                             } else {
-                                if (!constcreated) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated) label_created(label, &epoint);
                                 label->owner = true;
                                 label->value = none_value;
                             }
@@ -3000,18 +3049,12 @@ MUST_CHECK Obj *compile(void)
                                     goto as_command;
                                 }
                                 if (label->fwpass == pass) fwcount--;
-                                if (!constcreated && label->defpass != pass - 1) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated && label->defpass != pass - 1) label_created(label, &epoint);
                                 if (label->file_list != current_file_list) {
                                     label_move(label, &labelname, current_file_list);
                                 }
                             } else {
-                                if (!constcreated) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated) label_created(label, &epoint);
                                 label->owner = true;
                                 label->value = none_value;
                             }
@@ -3083,10 +3126,7 @@ MUST_CHECK Obj *compile(void)
                                     err_msg_double_defined(label, &labelname, &epoint);
                                 } else {
                                     if (label->fwpass == pass) fwcount--;
-                                    if (!constcreated && label->defpass != pass - 1) {
-                                        if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                        constcreated = true;
-                                    }
+                                    if (!constcreated && label->defpass != pass - 1) label_created(label, &epoint);
                                     label->constant = true;
                                     label->owner = true;
                                     if (label->file_list != current_file_list) {
@@ -3098,10 +3138,7 @@ MUST_CHECK Obj *compile(void)
                                     waitfor->u.cmd_macro.val = val_reference(label->value);
                                 }
                             } else {
-                                if (!constcreated) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated) label_created(label, &epoint);
                                 label->constant = true;
                                 label->owner = true;
                                 label->value = Obj(macro);
@@ -3131,6 +3168,8 @@ MUST_CHECK Obj *compile(void)
                             mfunc->nslen = 0;
                             mfunc->namespaces = NULL;
                             mfunc->ipoint = 0;
+                            mfunc->memo = NULL;
+                            mfunc->memolen = mfunc->memomask = 0;
                             if (prm == CMD_SFUNCTION && not_in_file(pline, current_file_list->file)) {
                                 size_t ln = strlen((const char *)pline) + 1;
                                 uint8_t *l = allocate_array(uint8_t, ln);
@@ -3147,10 +3186,7 @@ MUST_CHECK Obj *compile(void)
                                     failed = true;
                                 } else {
                                     if (label->fwpass == pass) fwcount--;
-                                    if (!constcreated && label->defpass != pass - 1) {
-                                        if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                        constcreated = true;
-                                    }
+                                    if (!constcreated && label->defpass != pass - 1) label_created(label, &epoint);
                                     label->constant = true;
                                     label->owner = true;
                                     if (label->file_list != current_file_list) {
@@ -3178,10 +3214,7 @@ MUST_CHECK Obj *compile(void)
                                 }
                             } else {
                                 mfunc->retval = false;
-                                if (!constcreated) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated) label_created(label, &epoint);
                                 label->constant = true;
                                 label->owner = true;
                                 label->value = Obj(mfunc);
@@ -3247,10 +3280,7 @@ MUST_CHECK Obj *compile(void)
                                     err_msg_double_defined(label, &labelname, &epoint);
                                 } else {
                                     if (label->fwpass == pass) fwcount--;
-                                    if (!constcreated && label->defpass != pass - 1) {
-                                        if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                        constcreated = true;
-                                    }
+                                    if (!constcreated && label->defpass != pass - 1) label_created(label, &epoint);
                                     label->constant = true;
                                     label->owner = true;
                                     if (label->file_list != current_file_list) {
@@ -3273,10 +3303,7 @@ MUST_CHECK Obj *compile(void)
                                     structure = Struct(label->value);
                                 }
                             } else {
-                                if (!constcreated) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated) label_created(label, &epoint);
                                 label->constant = true;
                                 label->owner = true;
                                 label->value = Obj(structure);
@@ -3305,11 +3332,12 @@ MUST_CHECK Obj *compile(void)
                             else {
                                 address_t end = (section_address.end < section_address.address) ? section_address.address : section_address.end;
                                 if (structure->size != (end & all_mem2)) {
-                                    structure->size = end & all_mem2;
                                     if (label->usepass >= pass) {
                                         if (fixeddig && pass > max_pass) err_msg_cant_calculate(&label->name, &label->epoint);
+                                        if (pass_tracing) pass_trace_address(&label->name, &label->epoint, "size", structure->size, end & all_mem2);
                                         fixeddig = false;
                                     }
+                                    structure->size = end & all_mem2;
                                 }
                             }
                             val_destroy(section_address.l_address_val);
@@ -3338,20 +3366,14 @@ MUST_CHECK Obj *compile(void)
                                     goto as_command;
                                 } else {
                                     if (label->fwpass == pass) fwcount--;
-                                    if (!constcreated && label->defpass != pass - 1) {
-                                        if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                        constcreated = true;
-                                    }
+                                    if (!constcreated && label->defpass != pass - 1) label_created(label, &epoint);
                                     if (label->file_list != current_file_list) {
                                         label_move(label, &labelname, current_file_list);
                                     }
                                     label->defpass = pass;
                                 }
                             } else {
-                                if (!constcreated) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated) label_created(label, &epoint);
                                 label->value = ref_none();
                             }
                             label->constant = true;
@@ -3390,10 +3412,7 @@ MUST_CHECK Obj *compile(void)
                                     err_msg_double_defined(label, &labelname, &epoint);
                                 } else {
                                     if (label->fwpass == pass) fwcount--;
-                                    if (!constcreated && label->defpass != pass - 1) {
-                                        if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                        constcreated = true;
-                                    }
+                                    if (!constcreated && label->defpass != pass - 1) label_created(label, &epoint);
                                     label->constant = true;
                                     label->owner = true;
                                     if (label->file_list != current_file_list) {
@@ -3403,10 +3422,7 @@ MUST_CHECK Obj *compile(void)
                                     label->ref = false;
                                 }
                             } else {
-                                if (!constcreated) {
-                                    if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                    constcreated = true;
-                                }
+                                if (!constcreated) label_created(label, &epoint);
                                 label->value = ref_none();
                                 label->constant = true;
                                 label->owner = true;
@@ -3550,10 +3566,7 @@ MUST_CHECK Obj *compile(void)
                                 } else {
                                     if (constant) {
                                         if (label->fwpass == pass) fwcount--;
-                                        if (!constcreated && label->defpass != pass - 1) {
-                                            if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                            constcreated = true;
-                                        }
+                                        if (!constcreated && label->defpass != pass - 1) label_created(label, &epoint);
                                     } else {
                                         if (label->defpass != pass) {
                                             label->ref = false;
@@ -3583,10 +3596,7 @@ MUST_CHECK Obj *compile(void)
                                 label->value = val;
                                 label->epoint = epoint;
                                 if (constant) {
-                                    if (!constcreated) {
-                                        if (pass > max_pass) err_msg_cant_calculate(&label->name, &epoint);
-                                        constcreated = true;
-                                    }
+                                    if (!constcreated) label_created(label, &epoint);
                                     label->ref = false;
                                 }
                             }
@@ -3599,6 +3609,7 @@ MUST_CHECK Obj *compile(void)
                 }
                 {
                     bool labelexists = false;
+                    function_impure(PURITY_NONE);
                     if (labelname.data[0] == '*') {
                         err_msg2(ERROR_RESERVED_LABL, &labelname, &epoint);
                         newlabel = NULL;
@@ -3647,10 +3658,7 @@ MUST_CHECK Obj *compile(void)
                             epoint = lpoint;
                             goto jn;
                         }
-                        if (!constcreated && newlabel->defpass != pass - 1) {
-                            if (pass > max_pass) err_msg_cant_calculate(&newlabel->name, &epoint);
-                            constcreated = true;
-                        }
+                        if (!constcreated && newlabel->defpass != pass - 1) label_created(newlabel, &epoint);
                         if (newlabel->fwpass == pass) fwcount--;
                         if (newlabel->file_list != current_file_list) {
                             label_move(newlabel, &labelname, current_file_list);
@@ -3661,8 +3669,7 @@ MUST_CHECK Obj *compile(void)
                             newlabel->defpass = pass;
                         }
                     } else if (!constcreated) {
-                        if (pass > max_pass) err_msg_cant_calculate(&newlabel->name, &epoint);
-                        constcreated = true;
+                        label_created(newlabel, &epoint);
                     }
                     if (labelexists) {
                         newlabel->constant = true;
@@ -3842,6 +3849,7 @@ MUST_CHECK Obj *compile(void)
                 break;
             }
         as_command:
+            if ((waitfor->skip & 1) != 0 && !function_command(prm)) function_impure(PURITY_NONE);
             switch (prm) {
             case CMD_ENDC: /* .endc */
                 if ((waitfor->skip & 1) != 0) listing_line(epoint.pos);
@@ -4740,6 +4748,7 @@ MUST_CHECK Obj *compile(void)
                                 oldstar = s->addr;
                                 if (s->addr != star) {
                                     if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &epoint);
+                                    if (pass_tracing) pass_trace_address(NULL, &epoint, "address", s->addr, star);
                                     fixeddig = false;
                                 }
                             } else oldstar = star;
@@ -4756,6 +4765,7 @@ MUST_CHECK Obj *compile(void)
                             if (fixeddig) {
                                 if (itt % uval != offset) {
                                     if (pass > max_pass) err_msg_still_align(&vs->epoint);
+                                    if (pass_tracing) pass_trace_note(NULL, &vs->epoint, "alignment changed");
                                     fixeddig = false;
                                 }
                             }
@@ -4764,6 +4774,7 @@ MUST_CHECK Obj *compile(void)
                     if (s != NULL) {
                         if (s->pass != 0 && s->addr != current_address->l_address) {
                             if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &epoint);
+                            if (pass_tracing) pass_trace_address(NULL, &epoint, "address", s->addr, current_address->l_address);
                             fixeddig = false;
                         }
                         s->addr = current_address->l_address;
@@ -4821,6 +4832,7 @@ MUST_CHECK Obj *compile(void)
                                 oldstar = s->addr;
                                 if (s->addr != star) {
                                     if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &epoint);
+                                    if (pass_tracing) pass_trace_address(NULL, &epoint, "address", s->addr, star);
                                     fixeddig = false;
                                 }
                             } else oldstar = star;
@@ -4847,6 +4859,7 @@ MUST_CHECK Obj *compile(void)
                                 offset -= itt;
                                 if ((ival >= 0) ? (offset < size) : (offset <= size)) {
                                     if (pass > max_pass) err_msg_still_align(&vs->epoint);
+                                    if (pass_tracing) pass_trace_note(NULL, &vs->epoint, "alignment changed");
                                     fixeddig = false;
                                 }
                             }
@@ -4855,6 +4868,7 @@ MUST_CHECK Obj *compile(void)
                     if (s != NULL) {
                         if (s->pass != 0 && s->addr != current_address->l_address) {
                             if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &epoint);
+                            if (pass_tracing) pass_trace_address(NULL, &epoint, "address", s->addr, current_address->l_address);
                             fixeddig = false;
                         }
                         s->addr = current_address->l_address;
@@ -5122,7 +5136,7 @@ MUST_CHECK Obj *compile(void)
                 { /* .cpu */
                     struct values_s *vs;
                     const struct cpu_s **cpui;
-                    static const struct cpu_s default_cpu = {"default", NULL, NULL, NULL, NULL, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+                    static const struct cpu_s default_cpu = {"default", NULL, NULL, 0, NULL, NULL, NULL, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
                     static const struct cpu_s *cpus[] = {
                         &c6502, &c65c02, &c65ce02, &c6502i, &w65816, &c65dtv02,
                         &c65el02, &r65c02, &w65c02, &c4510, &c45gs02, &default_cpu, NULL
@@ -5212,6 +5226,7 @@ MUST_CHECK Obj *compile(void)
 
                         if (s->pass != 0 && s->addr != star) {
                             if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &epoint);
+                            if (pass_tracing) pass_trace_address(NULL, &epoint, "address", s->addr, star);
                             fixeddig = false;
                         }
                         s->addr = star;
@@ -5554,6 +5569,7 @@ MUST_CHECK Obj *compile(void)
                             tmp3->address.mem->section = tmp3;
                             if (diagnostics.optimize) cpu_opt_invalidate();
                             if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &epoint);
+                            if (pass_tracing) pass_trace_note(&sectionname, &epoint, "section defined after use");
                             fixeddig = false;
                         }
                         tmp3->provides = ~(uval_t)0;tmp3->required = tmp3->conflicts = 0;
@@ -5583,6 +5599,7 @@ MUST_CHECK Obj *compile(void)
                                 tmp3->address.l_address = (tmp3->address.l_address + current_address->l_address - tmp3->l_restart) & all_mem;
                                 tmp3->l_restart = current_address->l_address;
                                 if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &epoint);
+                                if (pass_tracing) pass_trace_note(&sectionname, &epoint, "section logical address changed");
                                 fixeddig = false;
                             }
                         } else {
@@ -5600,6 +5617,7 @@ MUST_CHECK Obj *compile(void)
                             if (tmp3->l_restart != current_address->l_address) {
                                 tmp3->l_restart = current_address->l_address;
                                 if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &epoint);
+                                if (pass_tracing) pass_trace_note(&sectionname, &epoint, "section logical address changed");
                                 fixeddig = false;
                             }
                             tmp3->size = t;
@@ -5713,11 +5731,14 @@ MUST_CHECK Obj *compile(void)
                 as_opcode:
                         opname = labelname;
                     }
+                    function_impure(PURITY_NONE);
                     ignore();
                     oldlpoint = lpoint;
                     w = 3; /* 0=byte 1=word 2=long 3=negative/too big */
                     if (here() == 0 || here() == ';') {
+                        profile_enter(PROFILE_INSTRUCTION);
                         err = instruction(prm, w, NULL, 0, &epoint);
+                        profile_leave();
                     } else {
                         if (arguments.tasmcomp) {
                             if (here() == '!') {w = 1; lpoint.pos++;}
@@ -5745,7 +5766,9 @@ MUST_CHECK Obj *compile(void)
                         }
                         if (!get_exp(3, 0, 0, NULL)) goto breakerr;
                         get_vals_funcargs(&tmp);
+                        profile_enter(PROFILE_INSTRUCTION);
                         err = instruction(prm, w, tmp.val, tmp.len, &epoint);
+                        profile_leave();
                     }
                     if (err == NULL) {
                         if (llist != NULL) listing_instr(0, 0, -1);
@@ -5874,6 +5897,7 @@ static void one_pass(int argc, char **argv, int opts) {
     }
     if (fwcount != 0 || efwcount != 0) fixeddig = false;
     if (fixeddig && root_section.members.root != NULL) section_sizecheck(root_section.members.root);
+    if (pass_tracing) pass_trace_end(fwcount + efwcount);
     /*garbage_collect();*/
 }
 
@@ -5883,8 +5907,10 @@ int main2(int *argc2, char **argv2[]) {
     static const struct linepos_s nopoint = {0, 0};
     char **argv;
     int argc;
-    bool failed;
+    bool failed, seeded, rejected, noseed = false;
+    uint8_t first_pass;
 
+restart:
     compile_init(*argv2[0]);
 
     opts = init_arguments(argc2, argv2); argc = *argc2; argv = *argv2;
@@ -5893,42 +5919,65 @@ int main2(int *argc2, char **argv2[]) {
         return (opts < 0) ? EXIT_FAILURE : EXIT_SUCCESS;
     }
     init_encoding(arguments.to_ascii);
+    profile_init(&arguments.profile);
+    profile_init(&arguments.profile_json);
+    pass_trace_init(&arguments.pass_trace);
 
-    if (arguments.quiet) {
+    if (arguments.quiet && !noseed) {
         puts("64tass Turbo Assembler Macro V" VERSION "\n"
              "64TASS comes with ABSOLUTELY NO WARRANTY; This is free software, and you\n"
              "are welcome to redistribute it under certain conditions; See LICENSE!\n");
         fflush(stdout);
     }
 
+    /* labels of the previous build stand in for the first pass */
+    seeded = !noseed && seed_read(&arguments.seed);
+    rejected = false;
+    if (seeded) pass = 1;
+    first_pass = pass;
+
     /* assemble the input file(s) */
     do {
         if (pass++>max_pass) {err_msg(ERROR_TOO_MANY_PASS, NULL);break;}
-        listing_pccolumn = false;
+        listing_pass();
+        profile_pass(pass);
         one_pass(argc, argv, opts);
         if (signal_received) { err_msg_signal(); break; }
+        if (seeded) {
+            seeded = false;
+            if (seed_check()) {
+                rejected = true;
+                break;
+            }
+            if (seed_stale()) fixeddig = false;
+        }
     } while (!fixeddig || constcreated);
+    profile_pass(0);
 
-    if (arguments.list.name == NULL) {
-        if (diagnostics.unused.macro || diagnostics.unused.consts || diagnostics.unused.label || diagnostics.unused.variable) unused_check(root_namespace);
+    if (rejected) {
+        /* the seed did not hold, start over without it */
+        pass_trace_close(&arguments.pass_trace);
+        compile_destroy();
+        noseed = true;
+        goto restart;
     }
+
+    if (diagnostics.unused.macro || diagnostics.unused.consts || diagnostics.unused.label || diagnostics.unused.variable) unused_check(root_namespace);
     failed = error_serious();
     if (!failed) {
-        /* assemble again to create listing */
+        /* write out the listing recorded in the last pass */
         if (listing_open(&arguments.list, argc, argv)) {
-            nolisting = 0;
-
-            max_pass = pass; pass++;
-            one_pass(argc, argv, opts);
+            listing_flush();
             listing_close(&arguments.list);
-
-            if (diagnostics.unused.macro || diagnostics.unused.consts || diagnostics.unused.label || diagnostics.unused.variable) unused_check(root_namespace);
         }
 
+        profile_enter(PROFILE_OUTPUT);
         for (j = 0; j < arguments.symbol_output_len; j++) {
             labelprint(&arguments.symbol_output[j]);
         }
         if (arguments.make.name != NULL) makefile(argc - opts, argv + opts);
+        if (arguments.seed.name != NULL) seed_write(&arguments.seed);
+        profile_leave();
 
         failed = error_serious();
     }
@@ -5959,27 +6008,22 @@ int main2(int *argc2, char **argv2[]) {
                     if (fflush(stdout) != 0) setvbuf(stdout, NULL, _IOLBF, 1024);
                 }
             }
+            profile_enter(PROFILE_OUTPUT);
             if (output->mapname != NULL) memorymapfile(section->address.mem, output);
-            if (output->name != NULL) {
-                if (j == arguments.output_len - 1) {
-                    output_mem(section->address.mem, output);
-                } else {
-                    Memblocks *tmp = section->address.mem;
-                    section->address.mem = copy_memblocks(tmp);
-                    output_mem(tmp, output);
-                    val_destroy(Obj(section->address.mem));
-                    section->address.mem = tmp;
-                }
-            }
+            if (output->name != NULL) output_mem(section->address.mem, output);
+            profile_leave();
             section->parent = parent;
         }
         failed = error_serious();
     }
+    profile_print(&arguments.profile);
+    profile_print(&arguments.profile_json);
+    pass_trace_close(&arguments.pass_trace);
 
     error_print(&arguments.error);
     if (arguments.quiet) {
         error_status();
-        printf("Passes:            %u\n", pass);
+        printf("Passes:            %u\n", pass - first_pass);
         fflush(stdout);
     }
     compile_destroy();
@@ -74,6 +74,24 @@ static const struct arguments_s arguments_default = {
         false,   /* no_output */
         false    /* append */
     },
+    {            /* profile */
+        {0,0,0}, /* name_pos */
+        NULL,    /* name */
+        false    /* json */
+    },
+    {            /* profile_json */
+        {0,0,0}, /* name_pos */
+        NULL,    /* name */
+        true     /* json */
+    },
+    {            /* seed */
+        {0,0,0}, /* name_pos */
+        NULL     /* name */
+    },
+    {            /* pass_trace */
+        {0,0,0}, /* name_pos */
+        NULL     /* name */
+    },
     8,           /* tab_size */
 };
 
@@ -111,6 +129,7 @@ static const struct diagnostics_s diagnostics_default = {
     true,        /* star_assign */
     true,        /* ignored */
     false,       /* long_branch */
+    true,        /* branch_oscillation */
     false,       /* altmode */
     false,       /* align */
     true,        /* page */
@@ -154,6 +173,7 @@ static const struct diagnostics_s diagnostic_errors_default = {
     false,       /* star_assign */
     false,       /* ignored */
     false,       /* long_branch */
+    false,       /* branch_oscillation */
     false,       /* altmode */
     false,       /* align */
     true,        /* page */
@@ -200,6 +220,7 @@ static const struct diagnostics_s diagnostic_all_default = {
     true,        /* star_assign */
     true,        /* ignored */
     false,       /* long_branch */
+    true,        /* branch_oscillation */
     false,       /* altmode */
     false,       /* align */
     true,        /* page */
@@ -246,6 +267,7 @@ static const struct diagnostics_s diagnostic_error_all_default = {
     true,        /* star_assign */
     true,        /* ignored */
     true,        /* long_branch */
+    true,        /* branch_oscillation */
     true,        /* altmode */
     true,        /* align */
     true,        /* page */
@@ -292,6 +314,7 @@ static const struct w_options_s w_options[] = {
     {"star-assign",     &diagnostics.star_assign},
     {"ignored",         &diagnostics.ignored},
     {"long-branch",     &diagnostics.long_branch},
+    {"branch-oscillation", &diagnostics.branch_oscillation},
     {"altmode",         &diagnostics.altmode},
     {"align",           &diagnostics.align},
     {"page",            &diagnostics.page},
@@ -350,8 +373,8 @@ static bool woption(const char *s) {
     }
     if (m != SIZE_MAX) return false;
     fatal_error("unrecognized option '-W");
-    printable_print((const uint8_t *)s, stderr);
-    putc('\'', stderr);
+    printable_print((const uint8_t *)s, error_file());
+    putc('\'', error_file());
     fatal_error(NULL);
     return true;
 }
@@ -369,7 +392,8 @@ enum {
     OUTPUT_APPEND, NO_OUTPUT, ERROR_APPEND, NO_ERROR, LABELS_APPEND, MAP,
     NO_MAP, MAP_APPEND, LIST_APPEND, SIMPLE_LABELS, LABELS_SECTION,
     MESEN_LABELS, LABELS_ADD_PREFIX, MAKE_APPEND, C256_PGX, C256_PGZ,
-    OUTPUT_EXEC, M45GS02, CTAGS_LABELS, CODY_BIN, WDC_BIN
+    OUTPUT_EXEC, M45GS02, CTAGS_LABELS, CODY_BIN, WDC_BIN, PROFILE,
+    PROFILE_JSON, SEED_FILE, PASS_TRACE
 };
 
 static const struct my_option long_options[] = {
@@ -453,6 +477,10 @@ static const struct my_option long_options[] = {
     {"macro-caret-diag" , my_no_argument      , NULL,  MACRO_CARET_DIAG},
     {"caret-diag"       , my_no_argument      , NULL,  CARET_DIAG},
     {"tab-size"         , my_required_argument, NULL,  TAB_SIZE},
+    {"profile"          , my_required_argument, NULL,  PROFILE},
+    {"profile-json"     , my_required_argument, NULL,  PROFILE_JSON},
+    {"seed-file"        , my_required_argument, NULL,  SEED_FILE},
+    {"pass-trace"       , my_required_argument, NULL,  PASS_TRACE},
     {"version"          , my_no_argument      , NULL, 'V'},
     {"usage"            , my_no_argument      , NULL,  USAGE},
     {"help"             , my_no_argument      , NULL,  HELP},
@@ -524,6 +552,9 @@ static address_t check_outputs(void) {
     }
     if (arguments.list.name != NULL && dash_name(arguments.list.name)) tostdout = true;
     if (arguments.make.name != NULL && dash_name(arguments.make.name)) tostdout = true;
+    if (arguments.profile.name != NULL && dash_name(arguments.profile.name)) tostdout = true;
+    if (arguments.profile_json.name != NULL && dash_name(arguments.profile_json.name)) tostdout = true;
+    if (arguments.pass_trace.name != NULL && dash_name(arguments.pass_trace.name)) tostdout = true;
     if (!tostdout) {
         for (i = 0; i < arguments.symbol_output_len; i++) {
             struct symbol_output_s *symbol_output = &arguments.symbol_output[i];
@@ -591,6 +622,12 @@ static void get_arg(struct get_arg_s *param, struct argpos_s *argpos) {
     data[-1] = 0;
 }
 
+static void help_puts(const char *s) {
+    FILE *f = (error_stream != NULL) ? error_stream : stdout;
+    fputs(s, f);
+    putc('\n', f);
+}
+
 int init_arguments(int *argc2, char **argv2[]) {
     int argc = *argc2;
     char **argv = *argv2;
@@ -726,6 +763,10 @@ int init_arguments(int *argc2, char **argv2[]) {
             case 'L': arguments.list.name = my_optarg; get_arg(&get_args, &arguments.list.name_pos); arguments.list.append = (opt == LIST_APPEND); break;
             case MAKE_APPEND:
             case 'M': arguments.make.name = my_optarg; get_arg(&get_args, &arguments.make.name_pos); arguments.make.append = (opt == MAKE_APPEND); break;
+            case PROFILE: arguments.profile.name = my_optarg; get_arg(&get_args, &arguments.profile.name_pos); break;
+            case PROFILE_JSON: arguments.profile_json.name = my_optarg; get_arg(&get_args, &arguments.profile_json.name_pos); break;
+            case SEED_FILE: arguments.seed.name = my_optarg; get_arg(&get_args, &arguments.seed.name_pos); break;
+            case PASS_TRACE: arguments.pass_trace.name = my_optarg; get_arg(&get_args, &arguments.pass_trace.name_pos); break;
             case 'I': lastil = include_list_add(lastil, my_optarg);break;
             case 'm': arguments.list.monitor = false;break;
             case MONITOR: arguments.list.monitor = true;break;
@@ -746,7 +787,7 @@ int init_arguments(int *argc2, char **argv2[]) {
                     if (tab > 0 && tab <= 64 && *s == 0) arguments.tab_size = (unsigned int)tab;
                     break;
                 }
-            case USAGE:puts(
+            case USAGE:help_puts(
              /* 12345678901234567890123456789012345678901234567890123456789012345678901234567890 */
                "Usage: 64tass [-abBCfnTqwWcitxmse?V] [-D <label>=<value>] [-o <file>]\n"
                "        [-E <file>] [-I <path>] [-l <file>] [-L <file>] [-M <file>] [--ascii]\n"
@@ -766,14 +807,16 @@ int init_arguments(int *argc2, char **argv2[]) {
                "        [--output=<file>] [--output-append=<file>] [--output-exec=<expr>]\n"
                "        [--no-output] [--map=<file>] [--map-append=<file>] [--no-map]\n"
                "        [--error=<file>] [--error-append=<file>] [--quiet] [--no-warn]\n"
-               "        [--no-caret-diag] [--macro-caret-diag] [--help] [--usage] [--version]\n"
+               "        [--no-caret-diag] [--macro-caret-diag] [--profile=<file>]\n"
+               "        [--profile-json=<file>] [--seed-file=<file>]\n"
+               "        [--pass-trace=<file>] [--help] [--usage] [--version]\n"
                "        SOURCES\n");
                    return 0;
 
-            case 'V':puts("64tass Turbo Assembler Macro V" VERSION);
+            case 'V':help_puts("64tass Turbo Assembler Macro V" VERSION);
                      return 0;
             case HELP:
-            case '?':if (my_optopt == '?' || opt == HELP) { puts(
+            case '?':if (my_optopt == '?' || opt == HELP) { help_puts(
                "Usage: 64tass [OPTIONS...] SOURCES\n"
                "64tass Turbo Assembler Macro V" VERSION "\n"
                "\n"
@@ -809,6 +852,8 @@ int init_arguments(int *argc2, char **argv2[]) {
                "  -Wleading-zeros        Warn for ignored leading zeros\n"
                "  -Wlong-branch          Warn when a long branch is used\n"
                "  -Wmacro-prefix         Warn about unprefixed macro calls\n"
+               "  -Wno-branch-oscillation\n"
+               "                         No oscillating branch warnings\n"
                "  -Wno-deprecated        No deprecated feature warnings\n"
                "  -Wno-float-compare     No approximate compare warnings\n"
                "  -Wno-float-round       No implicit rounding warnings\n"
@@ -836,7 +881,7 @@ int init_arguments(int *argc2, char **argv2[]) {
                "  -Wunused-const         Warn about unused consts\n"
                "  -Wunused-label         Warn about unused labels\n"
                "  -Wunused-variable      Warn about unused variables\n");
-               puts(" Output selection:\n"
+               help_puts(" Output selection:\n"
                "  -o, --output=<file>    Place output into <file>\n"
                "      --output-append=<f> Append output to <file>\n"
                "      --no-output        Do not create an output file\n"
@@ -895,6 +940,10 @@ int init_arguments(int *argc2, char **argv2[]) {
                "      --verbose-list     List unused lines as well\n"
                "\n"
                " Misc:\n"
+               "      --profile=<f>      Place pass and phase timings into <file>\n"
+               "      --profile-json=<f> Place timings into <file> as JSON\n"
+               "      --seed-file=<f>    Reuse and update label values in <file>\n"
+               "      --pass-trace=<f>   Place changes causing extra passes into <file>\n"
                "  -?, --help             Give this help list\n"
                "      --usage            Give a short usage message\n"
                "  -V, --version          Print program version\n"
@@ -908,7 +957,7 @@ int init_arguments(int *argc2, char **argv2[]) {
                 FALL_THROUGH; /* fall through */
             default:
             exit:
-                fputs("Try '64tass --help' or '64tass --usage' for more information.\n", stderr);
+                fputs("Try '64tass --help' or '64tass --usage' for more information.\n", error_file());
                 return -1;
             }
         }
@@ -991,7 +1040,7 @@ int init_arguments(int *argc2, char **argv2[]) {
     }
     if (argc <= my_optind) {
         fputs("Usage: 64tass [OPTIONS...] SOURCES\n"
-              "Try '64tass --help' or '64tass --usage' for more information.\n", stderr);
+              "Try '64tass --help' or '64tass --usage' for more information.\n", error_file());
         return -1;
     }
     return my_optind;
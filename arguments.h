@@ -96,6 +96,22 @@ struct make_output_s {
     bool append;
 };
 
+struct profile_output_s {
+    struct argpos_s name_pos;
+    const char *name;
+    bool json;
+};
+
+struct seed_file_s {
+    struct argpos_s name_pos;
+    const char *name;
+};
+
+struct pass_trace_s {
+    struct argpos_s name_pos;
+    const char *name;
+};
+
 struct arguments_data_s {
     uint8_t *data;
     size_t len;
@@ -129,6 +145,10 @@ struct arguments_s {
     struct arguments_data_s defines;
     struct arguments_data_s commandline;
     struct error_output_s error;
+    struct profile_output_s profile;
+    struct profile_output_s profile_json;
+    struct seed_file_s seed;
+    struct pass_trace_s pass_trace;
     unsigned int tab_size;
 };
 
@@ -166,6 +186,7 @@ struct diagnostics_s {
     bool star_assign;
     bool ignored;
     bool long_branch;
+    bool branch_oscillation;
     bool altmode;
     bool align;
     bool page;
@@ -24,6 +24,7 @@
 #include "unicode.h"
 #include "error.h"
 #include "arguments.h"
+#include "macro.h"
 
 #include "codeobj.h"
 #include "boolobj.h"
@@ -644,6 +645,7 @@ MUST_CHECK Obj *bits_from_str(Str *v1, linepos_t epoint) {
     size_t j, sz, osz;
     bdigit_t *d, uv;
 
+    function_impure(PURITY_NONE); /* encoding dependent */
     if (actual_encoding->updating) {
         if (v1->chars == 1) {
             unichar_t ch2 = v1->data[0];
@@ -882,7 +884,7 @@ static MUST_CHECK Obj *calc1(oper_t op) {
 
 static inline MUST_CHECK Obj *binary(oper_t op) {
     Bits *vv1 = Bits(op->v1), *vv2 = Bits(op->v2);
-    size_t i, len1, len2, sz;
+    size_t len1, len2, sz;
     bool neg;
     const bdigit_t *v1, *v2;
     bdigit_t *v;
@@ -920,7 +922,6 @@ static inline MUST_CHECK Obj *binary(oper_t op) {
     v = vv->data;
     v1 = vv1->data; v2 = vv2->data;
 
-    i = 0;
     switch (op->op) {
     case O_AND:
         if (vv1->bits < vv2->bits) {
@@ -928,22 +929,9 @@ static inline MUST_CHECK Obj *binary(oper_t op) {
         } else {
             vv->bits = (vv2->len < 0) ? vv1->bits : vv2->bits;
         }
-        if (vv1->len < 0) {
-            if (vv2->len < 0) {
-                neg = true;
-                for (; i < len2; i++) v[i] = v1[i] | v2[i];
-            } else {
-                neg = false;
-                for (; i < len2; i++) v[i] = ~v1[i] & v2[i];
-            }
-        } else {
-            neg = false;
-            if (vv2->len < 0) {
-                for (; i < len2; i++) v[i] = v1[i] & ~v2[i];
-            } else {
-                for (; i < len2; i++) v[i] = v1[i] & v2[i];
-            }
-        }
+        neg = (vv1->len < 0) && (vv2->len < 0);
+        if (neg) bytes_bitwise((uint8_t *)v, (const uint8_t *)v1, (const uint8_t *)v2, len2 * sizeof *v, O_OR, false, false);
+        else bytes_bitwise((uint8_t *)v, (const uint8_t *)v1, (const uint8_t *)v2, len2 * sizeof *v, O_AND, vv1->len < 0, vv2->len < 0);
         break;
     case O_OR:
         if (vv1->bits < vv2->bits) {
@@ -951,31 +939,18 @@ static inline MUST_CHECK Obj *binary(oper_t op) {
         } else {
             vv->bits = (vv2->len < 0) ? vv2->bits : vv1->bits;
         }
-        if (vv1->len < 0) {
-            neg = true;
-            if (vv2->len < 0) {
-                for (; i < len2; i++) v[i] = v1[i] & v2[i];
-            } else {
-                for (; i < len2; i++) v[i] = v1[i] & ~v2[i];
-            }
-        } else {
-            if (vv2->len < 0) {
-                neg = true;
-                for (; i < len2; i++) v[i] = ~v1[i] & v2[i];
-            } else {
-                neg = false;
-                for (; i < len2; i++) v[i] = v1[i] | v2[i];
-            }
-        }
+        neg = (vv1->len < 0) || (vv2->len < 0);
+        if (neg) bytes_bitwise((uint8_t *)v, (const uint8_t *)v1, (const uint8_t *)v2, len2 * sizeof *v, O_AND, vv1->len >= 0, vv2->len >= 0);
+        else bytes_bitwise((uint8_t *)v, (const uint8_t *)v1, (const uint8_t *)v2, len2 * sizeof *v, O_OR, false, false);
         break;
     default:
         vv->bits = vv2->bits > vv1->bits ? vv2->bits : vv1->bits;
         neg = (vv1->len < 0) != (vv2->len < 0);
-        for (; i < len2; i++) v[i] = v1[i] ^ v2[i];
+        bytes_bitwise((uint8_t *)v, (const uint8_t *)v1, (const uint8_t *)v2, len2 * sizeof *v, O_XOR, false, false);
         break;
     }
-    for (; i < sz; i++) v[i] = v1[i];
-    return normalize(vv, i, neg);
+    if (v != v1 && sz > len2) memcpy(v + len2, v1 + len2, (sz - len2) * sizeof *v);
+    return normalize(vv, sz, neg);
 }
 
 static inline MUST_CHECK Obj *concat(oper_t op) {
@@ -23,6 +23,7 @@
 #include "unicode.h"
 #include "variables.h"
 #include "arguments.h"
+#include "macro.h"
 #include "error.h"
 
 #include "boolobj.h"
@@ -547,6 +548,7 @@ MUST_CHECK Obj *bytes_from_str(Str *v1, linepos_t epoint, Textconv_types mode) {
     if (len != 0 || len2 != 0) {
         struct encoder_s *encoder;
         int ch;
+        function_impure(PURITY_NONE); /* encoding dependent */
         if (actual_encoding->updating) {
             if (v1->chars == 1) {
                 unichar_t ch2 = v1->data[0];
@@ -881,9 +883,46 @@ static void getriter(struct iter_s *v) {
     v->len = byteslen(Bytes(v->data));
 }
 
+/* Bitwise operation on byte arrays a machine word at a time, the operands
+ * are inverted first if requested. The result may overlap the operands. */
+void bytes_bitwise(uint8_t *v, const uint8_t *v1, const uint8_t *v2, size_t len, Oper_types op, bool inv1, bool inv2) {
+    size_t i = 0, w1, w2;
+    size_t m1 = inv1 ? ~(size_t)0 : 0;
+    size_t m2 = inv2 ? ~(size_t)0 : 0;
+    switch (op) {
+    case O_AND:
+        for (; len - i >= sizeof w1; i += sizeof w1) {
+            memcpy(&w1, v1 + i, sizeof w1);
+            memcpy(&w2, v2 + i, sizeof w2);
+            w1 = (w1 ^ m1) & (w2 ^ m2);
+            memcpy(v + i, &w1, sizeof w1);
+        }
+        for (; i < len; i++) v[i] = (uint8_t)((v1[i] ^ m1) & (v2[i] ^ m2));
+        break;
+    case O_OR:
+        for (; len - i >= sizeof w1; i += sizeof w1) {
+            memcpy(&w1, v1 + i, sizeof w1);
+            memcpy(&w2, v2 + i, sizeof w2);
+            w1 = (w1 ^ m1) | (w2 ^ m2);
+            memcpy(v + i, &w1, sizeof w1);
+        }
+        for (; i < len; i++) v[i] = (uint8_t)((v1[i] ^ m1) | (v2[i] ^ m2));
+        break;
+    default:
+        for (; len - i >= sizeof w1; i += sizeof w1) {
+            memcpy(&w1, v1 + i, sizeof w1);
+            memcpy(&w2, v2 + i, sizeof w2);
+            w1 = (w1 ^ m1) ^ (w2 ^ m2);
+            memcpy(v + i, &w1, sizeof w1);
+        }
+        for (; i < len; i++) v[i] = (uint8_t)((v1[i] ^ m1) ^ (v2[i] ^ m2));
+        break;
+    }
+}
+
 static inline MUST_CHECK Obj *binary(oper_t op) {
     Bytes *vv1 = Bytes(op->v1), *vv2 = Bytes(op->v2);
-    size_t i, len1, len2, sz;
+    size_t len1, len2, sz;
     bool neg1, neg2, neg;
     const uint8_t *v1, *v2;
     uint8_t *v;
@@ -924,45 +963,22 @@ static inline MUST_CHECK Obj *binary(oper_t op) {
     v = vv->data;
     v1 = vv1->data; v2 = vv2->data;
 
-    i = 0;
     switch (op->op) {
     case O_AND:
-        if (neg1) {
-            if (neg2) {
-                for (; i < len2; i++) v[i] = v1[i] | v2[i];
-            } else {
-                for (; i < len2; i++) v[i] = (uint8_t)(~v1[i] & v2[i]);
-            }
-        } else {
-            if (neg2) {
-                for (; i < len2; i++) v[i] = (uint8_t)(v1[i] & ~v2[i]);
-            } else {
-                for (; i < len2; i++) v[i] = v1[i] & v2[i];
-            }
-        }
+        if (neg1 && neg2) bytes_bitwise(v, v1, v2, len2, O_OR, false, false);
+        else bytes_bitwise(v, v1, v2, len2, O_AND, neg1, neg2);
         break;
     case O_OR:
-        if (neg1) {
-            if (neg2) {
-                for (; i < len2; i++) v[i] = v1[i] & v2[i];
-            } else {
-                for (; i < len2; i++) v[i] = (uint8_t)(v1[i] & ~v2[i]);
-            }
-        } else {
-            if (neg2) {
-                for (; i < len2; i++) v[i] = (uint8_t)(~v1[i] & v2[i]);
-            } else {
-                for (; i < len2; i++) v[i] = v1[i] | v2[i];
-            }
-        }
+        if (neg1 || neg2) bytes_bitwise(v, v1, v2, len2, O_AND, !neg1, !neg2);
+        else bytes_bitwise(v, v1, v2, len2, O_OR, false, false);
         break;
     default:
-        for (; i < len2; i++) v[i] = v1[i] ^ v2[i];
+        bytes_bitwise(v, v1, v2, len2, O_XOR, false, false);
         break;
     }
-    for (; i < sz; i++) v[i] = v1[i];
-    /*if (i > SSIZE_MAX) err_msg_out_of_memory();*/ /* overflow */
-    vv->len = (ssize_t)(neg ? ~i : i);
+    if (v != v1 && sz > len2) memcpy(v + len2, v1 + len2, sz - len2);
+    /*if (sz > SSIZE_MAX) err_msg_out_of_memory();*/ /* overflow */
+    vv->len = (ssize_t)(neg ? ~sz : sz);
     return Obj(vv);
 }
 
@@ -970,7 +986,7 @@ static MUST_CHECK Obj *concat(oper_t op) {
     Bytes *v1 = Bytes(op->v1), *v2 = Bytes(op->v2), *v;
     uint8_t *s;
     bool inv;
-    size_t ln, i, len1, len2;
+    size_t ln, len1, len2;
 
     if (v2->len == 0 || v2->len == ~(ssize_t)0) {
         return Obj(ref_bytes(v1));
@@ -999,12 +1015,8 @@ static MUST_CHECK Obj *concat(oper_t op) {
         } else ln2 = ln;
         s = extend_bytes(v2, ln2);
         if (s == NULL) goto failed;
-        if (inv) {
-            for (i = len2; i != 0;) {
-                i--;
-                s[i + len1] = (uint8_t)~v2->data[i];
-            }
-        } else memmove(s + len1, v2->data, len2);
+        memmove(s + len1, v2->data, len2);
+        if (inv) bytes_bitwise(s + len1, s + len1, s + len1, len2, O_OR, true, true);
         memcpy(s, v1->data, len1);
         v2->len = (ssize_t)(v1->len < 0 ? ~ln : ln);
         return val_reference(Obj(v2));
@@ -1015,7 +1027,7 @@ static MUST_CHECK Obj *concat(oper_t op) {
         memcpy(s, v1->data, len1);
     }
     if (inv) {
-        for (i = 0; i < len2; i++) s[i + len1] = (uint8_t)~v2->data[i];
+        bytes_bitwise(s + len1, v2->data, v2->data, len2, O_OR, true, true);
     } else if (len2 == 1) {
         s[len1] = v2->data[0];
     } else {
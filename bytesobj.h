@@ -19,6 +19,8 @@
 #ifndef BYTESOBJ_H
 #define BYTESOBJ_H
 #include "obj.h"
+#include "oper_e.h"
+#include "stdbool.h"
 
 extern struct Type *const BYTES_OBJ;
 
@@ -66,4 +68,5 @@ extern MUST_CHECK Obj *bytes_from_hexstr(const uint8_t *, linecpos_t *, linepos_
 extern MUST_CHECK Obj *bytes_from_z85str(const uint8_t *, linecpos_t *, linepos_t);
 extern MUST_CHECK Obj *bytes_from_obj(Obj *, linepos_t);
 extern MUST_CHECK Obj *float_from_bytes(const Bytes *, linepos_t);
+extern void bytes_bitwise(uint8_t *, const uint8_t *, const uint8_t *, size_t, Oper_types, bool, bool);
 #endif
@@ -357,7 +357,7 @@ struct code_item_s {
 };
 
 static MUST_CHECK Obj *code_item(const struct code_item_s *ci) {
-    int r;
+    uint8_t d[sizeof(uval_t)];
     address_t i2;
     address_t offs;
     uval_t val;
@@ -369,14 +369,16 @@ static MUST_CHECK Obj *code_item(const struct code_item_s *ci) {
         offs = ci->offs2 + (uval_t)ci->offs0;
     }
     offs *= ci->ln2;
-    r = -1;
+    if (ci->v1->memblocks == seed_memblocks) {
+        fixeddig = false; /* contents were not seeded */
+        return ref_gap();
+    }
+    if (copy_mem(d, ci->v1->memblocks, ci->v1->memaddr, ci->v1->membp, offs, ci->ln2) != ci->ln2) return ref_gap();
     val = 0;
-    for (i2 = 0; i2 < ci->ln2; i2++, offs++) {
-        r = read_mem(ci->v1->memblocks, ci->v1->memaddr, ci->v1->membp, offs);
-        if (r < 0) return ref_gap();
-        val |= (uval_t)r << (i2 * 8);
+    for (i2 = 0; i2 < ci->ln2; i2++) {
+        val |= (uval_t)d[i2] << (i2 * 8);
     }
-    if (ci->v1->dtype < 0 && (r & 0x80) != 0) {
+    if (ci->v1->dtype < 0 && (d[i2 - 1] & 0x80) != 0) {
         for (; i2 < sizeof val; i2++) val |= (uval_t)0xff << (i2 * 8);
     }
     return (ci->v1->dtype < 0) ? int_from_ival((ival_t)val) : int_from_uval(val);
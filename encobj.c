@@ -33,6 +33,7 @@
 #include "bytesobj.h"
 #include "bitsobj.h"
 #include "errorobj.h"
+#include "passtrace.h"
 #include "functionobj.h"
 
 Enc *actual_encoding;
@@ -157,6 +158,7 @@ retry:
         tmp->fwpass = 0;
         tmp->pass = pass;
         if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+        if (pass_tracing) pass_trace_note(NULL, epoint, "new character translation");
         fixeddig = false;
         return false;
     }
@@ -178,6 +180,7 @@ retry:
     if (tmp->range.offset != range->offset) {
         tmp->range.offset = range->offset;
         if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+        if (pass_tracing) pass_trace_note(NULL, epoint, "character translation changed");
         fixeddig = false;
     }
     return false;
@@ -262,6 +265,7 @@ bool enc_escape_add(Enc *enc, const str_t *v, Obj *val, linepos_t epoint)
         }
 
         if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+        if (pass_tracing) pass_trace_note(NULL, epoint, "new escape sequence");
         fixeddig = false;
         return false;
     }
@@ -290,6 +294,7 @@ bool enc_escape_add(Enc *enc, const str_t *v, Obj *val, linepos_t epoint)
         b->len = i;
         b->data = d;
         if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+        if (pass_tracing) pass_trace_note(NULL, epoint, "escape sequence changed");
         fixeddig = false;
     } else {
         if (tmp.val != d) free(d);
@@ -23,6 +23,7 @@
 #include "values.h"
 #include "64tass.h"
 #include "str.h"
+#include "passtrace.h"
 
 #include "encobj.h"
 
@@ -646,9 +647,10 @@ static bool ascii_mode;
 
 static Enc *enc_from_name(str_t *name, linepos_t epoint) {
     Enc *enc = Enc(new_enc(current_file_list, epoint));
-    bool oldfixeddig = fixeddig;
+    bool oldfixeddig = fixeddig, oldtracing = pass_tracing;
     uint8_t oldpass = pass;
     fixeddig = false;
+    pass_tracing = false;
     pass = 255;
     if (name->len == 4 && memcmp(name->data, "none", 4) == 0) {
         if (!ascii_mode) {
@@ -666,6 +668,7 @@ static Enc *enc_from_name(str_t *name, linepos_t epoint) {
         }
     }
     pass = oldpass;
+    pass_tracing = oldtracing;
     fixeddig = oldfixeddig;
     return enc;
 }
@@ -681,5 +684,7 @@ void init_encoding(bool toascii)
 void destroy_encoding(void)
 {
     avltree_destroy(&encoding_tree, encoding_free);
+    avltree_init(&encoding_tree);
     free(lasten);
+    lasten = NULL;
 }
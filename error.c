@@ -27,6 +27,7 @@
 #include "opcodes.h"
 #include "section.h"
 #include "macro.h"
+#include "profile.h"
 
 #include "strobj.h"
 #include "addressobj.h"
@@ -44,10 +45,13 @@
 struct file_list_s *current_file_list;
 struct file_list_s *commandline_file_list;
 const struct file_list_s *dummy_file_list;
+FILE *error_stream;
+jmp_buf *error_abort;
 
 #define ALIGN(v) (((v) + (sizeof(int *) - 1)) & ~(sizeof(int *) - 1))
 
 static unsigned int errors = 0, warnings = 0;
+static size_t messages = 0;
 
 struct file_listnode_s {
     struct file_list_s flist;
@@ -161,6 +165,7 @@ static NO_RETURN void err_msg_out_of_memory2(void)
 {
     fatal_error("out of memory");
     fatal_error(NULL);
+    if (error_abort != NULL) longjmp(*error_abort, 1);
     exit(EXIT_FAILURE);
 }
 
@@ -189,6 +194,7 @@ static struct errorentry_s *new_error_msg_common(const uint8_t *line) {
     struct errorentry_s *err;
     size_t line_len;
     close_error();
+    messages++;
     if (add_overflow(error_list.header_pos, sizeof *err, &error_list.len)) err_msg_out_of_memory2();
     if (line == NULL) {
         line_len = 0;
@@ -327,11 +333,15 @@ void enterfile(struct file_s *file, linepos_t epoint) {
     }
     cflist->pass = pass;
     current_file_list = &cflist->flist;
+    profile_file(file);
 }
 
 void exitfile(void) {
     struct file_listnode_s *cflist = (struct file_listnode_s *)current_file_list;
-    if (cflist->parent != NULL) current_file_list = &cflist->parent->flist;
+    if (cflist->parent != NULL) {
+        current_file_list = &cflist->parent->flist;
+        profile_file(current_file_list->file);
+    }
 }
 
 static const char *const terr_warning[] = {
@@ -422,6 +432,9 @@ static const char *const terr_fatal[] = {
     "can't write make file",
     "can't write error file",
     "can't write map file",
+    "can't write profile file",
+    "can't write seed file",
+    "can't write pass trace file",
     "file recursion",
     "macro recursion too deep",
     "function recursion too deep",
@@ -527,6 +540,10 @@ void err_msg2(Error_types no, const void *prm, linepos_t epoint) {
             new_error_msg2(diagnostic_errors.long_branch, epoint);
             adderror("long branch used [-Wlong-branch]");
             break;
+        case ERROR_BRANCH_OSCILL:
+            new_error_msg2(diagnostic_errors.branch_oscillation, epoint);
+            adderror("branch kept long as it was oscillating between short and long [-Wbranch-oscillation]");
+            break;
         case ERROR_WUSER_DEFINED:
             more = new_error_msg(SV_WARNING, current_file_list, epoint);
             adderror2(((const Str *)prm)->data, ((const Str *)prm)->len);
@@ -1553,7 +1570,9 @@ void error_print(const struct error_output_s *output) {
             err_msg_file2(ERROR_CANT_WRTE_ERR, output->name, &output->name_pos);
             ferr = stderr;
         }
-    } else ferr = output->no_output ? NULL : stderr;
+    } else if (output->no_output) {
+        ferr = NULL;
+    } else ferr = error_file();
 
     warnings = errors = 0;
     close_error();
@@ -1623,7 +1642,7 @@ void error_print(const struct error_output_s *output) {
     if (ferr == NULL) return;
     if (err3 != NULL) print_error(ferr, err3, different_line(err2, err3));
     if (err2 != NULL) print_error(ferr, err2, caret_needed(err2));
-    if (ferr != stderr && ferr != stdout) fclose(ferr); else fflush(ferr);
+    if (ferr != stderr && ferr != stdout && ferr != error_stream) fclose(ferr); else fflush(ferr);
     console_use(NULL);
 }
 
@@ -1674,23 +1693,28 @@ void err_destroy(void) {
     free(lastnd);
 }
 
+FILE *error_file(void) {
+    return (error_stream != NULL) ? error_stream : stderr;
+}
+
 void fatal_error(const char *txt) {
+    FILE *f = error_file();
     if (txt != NULL) {
-        console_use(stderr);
-        if (console_use_color) console_bold(stderr);
-        printable_print((const uint8_t *)prgname, stderr);
-        fputs(": ", stderr);
-        if (console_use_color) console_red(stderr);
-        fputs("fatal error: ", stderr);
+        console_use(f);
+        if (console_use_color) console_bold(f);
+        printable_print((const uint8_t *)prgname, f);
+        fputs(": ", f);
+        if (console_use_color) console_red(f);
+        fputs("fatal error: ", f);
         if (console_use_color) {
-            console_default(stderr);
-            console_bold(stderr);
+            console_default(f);
+            console_bold(f);
         }
-        fputs(txt, stderr);
+        fputs(txt, f);
         return;
     }
-    if (console_use_color) console_default(stderr);
-    putc('\n', stderr);
+    if (console_use_color) console_default(f);
+    putc('\n', f);
 }
 
 NO_RETURN void err_msg_out_of_memory(void)
@@ -1757,6 +1781,10 @@ linecpos_t interstring_position(linepos_t epoint, const uint8_t *data, size_t i)
     return epoint->pos;
 }
 
+size_t error_messages(void) {
+    return messages;
+}
+
 bool error_serious(void) {
     const struct errorentry_s *err;
     size_t pos;
@@ -18,6 +18,8 @@
 */
 #ifndef ERROR_H
 #define ERROR_H
+#include <stdio.h>
+#include <setjmp.h>
 #include "attributes.h"
 #include "stdbool.h"
 #include "errors_e.h"
@@ -33,6 +35,8 @@ struct file_list_s {
 extern struct file_list_s *current_file_list;
 extern struct file_list_s *commandline_file_list;
 extern const struct file_list_s *dummy_file_list;
+extern FILE *error_stream;
+extern jmp_buf *error_abort;
 
 struct Obj;
 struct Str;
@@ -120,11 +124,13 @@ extern void enterfile(struct file_s *, linepos_t);
 extern void exitfile(void);
 extern void err_init(const char *);
 extern void err_destroy(void);
+extern FILE *error_file(void);
 extern void fatal_error(const char *);
 extern void NO_RETURN err_msg_out_of_memory(void);
 extern void err_msg_signal(void);
 extern void error_status(void);
 extern bool error_serious(void);
+extern size_t error_messages(void);
 extern linecpos_t interstring_position(linepos_t, const uint8_t *, size_t);
 
 #if __has_builtin(__builtin_mul_overflow)
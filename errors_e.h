@@ -52,6 +52,7 @@ typedef enum Error_types {
     ERROR_LEADING_ZEROS,
     ERROR_DIRECTIVE_IGN,
     ERROR___LONG_BRANCH,
+    ERROR_BRANCH_OSCILL,
     ERROR___FLOAT_ROUND,
 
     ERROR__DOUBLE_RANGE = 0x40,
@@ -139,6 +140,9 @@ typedef enum Error_types {
     ERROR_CANT_WRTE_MAK,
     ERROR_CANT_WRTE_ERR,
     ERROR_CANT_WRTE_MAP,
+    ERROR_CANT_WRTE_PRF,
+    ERROR_CANT_WRTE_SEED,
+    ERROR_CANT_WRTE_TRC,
     ERROR_FILERECURSION,
     ERROR__MACRECURSION,
     ERROR__FUNRECURSION,
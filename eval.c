@@ -29,6 +29,9 @@
 #include "arguments.h"
 #include "optimizer.h"
 #include "unicodedata.h"
+#include "profile.h"
+#include "file.h"
+#include "macro.h"
 
 #include "floatobj.h"
 #include "boolobj.h"
@@ -364,6 +367,7 @@ MUST_CHECK Obj *get_star_value(address_t addr, Obj *val) {
 
 MUST_CHECK Obj *get_star(void) {
     Code *code;
+    function_impure(PURITY_NONE);
     if (diagnostics.optimize) cpu_opt_invalidate();
     code = new_code();
     code->addr = star;
@@ -446,6 +450,120 @@ static struct eval_context_s {
 
 static struct eval_context_s *eval;
 
+typedef enum Exp_types {
+    EXP_VALUE, EXP_OPER, EXP_LABEL, EXP_SYMBOL, EXP_ANONSYMBOL, EXP_ANONLABEL,
+    EXP_STAR, EXP_STARSYMBOL
+} Exp_types;
+
+struct expitem_s {
+    union {
+        Obj *val;
+        Oper_types op;
+        ssize_t as;
+        int hash;
+    } u;
+    linecpos_t pos, start, len;
+    uint8_t kind;
+};
+
+struct exprecord_s {
+    struct expitem_s item;
+    argcount_t index;
+};
+
+struct expcache_s {
+    linecpos_t pos, end;
+    int stop;
+    argcount_t len;
+    struct expcache_s *next;
+    struct expitem_s items[1];
+};
+
+struct expchunk_s {
+    size_t len;
+    struct expchunk_s *next;
+    union {
+        struct expcache_s c;
+        uint8_t data[0x10000];
+    } u;
+};
+
+static struct {
+    struct expchunk_s *chunks;
+} expcache;
+
+static struct {
+    struct exprecord_s *data;
+    argcount_t p, len;
+} exprecord;
+
+static struct file_s *expcache_file(void) {
+    struct file_s *cfile = current_file_list->file;
+    linenum_t lnum = lpoint.line - 1;
+    if (lnum >= cfile->lines || pline != cfile->source.data + cfile->line[lnum]) return NULL; /* macro expanded */
+    return cfile;
+}
+
+static const struct expcache_s *expcache_lookup(const struct file_s *cfile, int stop) {
+    const struct expcache_s *c;
+    if (cfile->expcache == NULL) return NULL;
+    c = cfile->expcache[lpoint.line - 1];
+    while (c != NULL) {
+        if (c->pos == lpoint.pos && c->stop == stop) return c;
+        c = c->next;
+    }
+    return NULL;
+}
+
+/* Only lines parsed more than once in a pass (loop and function bodies) are
+   worth remembering, straight code is parsed again in the next pass */
+static bool expcache_seen(struct file_s *cfile) {
+    linenum_t lnum = lpoint.line - 1;
+    if (cfile->expseen == NULL) {
+        new_array(&cfile->expseen, cfile->lines);
+        memset(cfile->expseen, 0, cfile->lines * sizeof *cfile->expseen);
+    }
+    if (cfile->expseen[lnum] == pass) return true;
+    cfile->expseen[lnum] = pass;
+    return false;
+}
+
+static size_t expcache_size(argcount_t len) {
+    size_t size = sizeof(struct expcache_s) - sizeof(struct expitem_s) + len * sizeof(struct expitem_s);
+    return (size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+}
+
+/* Entries are allocated in source order from large chunks */
+static struct expcache_s *expcache_alloc(argcount_t len) {
+    struct expchunk_s *chunk = expcache.chunks;
+    struct expcache_s *c;
+    size_t size;
+    if (len > sizeof chunk->u / sizeof c->items[0]) return NULL;
+    size = expcache_size(len);
+    if (size > sizeof chunk->u) return NULL;
+    if (chunk == NULL || chunk->len + size > sizeof chunk->u) {
+        new_instance(&chunk);
+        chunk->len = 0;
+        chunk->next = expcache.chunks;
+        expcache.chunks = chunk;
+    }
+    c = (struct expcache_s *)(chunk->u.data + chunk->len);
+    chunk->len += size;
+    c->len = len;
+    return c;
+}
+
+static void exprecord_add(argcount_t index, Exp_types kind, linecpos_t start, linecpos_t len, ssize_t as) {
+    struct exprecord_s *r;
+    if (exprecord.p >= exprecord.len) extend_array(&exprecord.data, &exprecord.len, 16);
+    r = &exprecord.data[exprecord.p++];
+    r->index = index;
+    r->item.kind = (uint8_t)kind;
+    r->item.start = start;
+    r->item.len = len;
+    r->item.u.as = as;
+}
+
 static NO_INLINE void extend_out(struct out_list_s *out) {
     argcount_t size = (argcount_t)(out->max - out->data);
     argcount_t p = (argcount_t)(out->p - out->data);
@@ -1381,11 +1499,113 @@ argcount_t get_val_remaining(void) {
 /* 4 - opcode, with defaults */
 /* 5 - 1 only, till comma/equal  */
 
+static MUST_CHECK Obj *find_symbol(const str_t *symbol, int hash, linepos_t epoint) {
+    bool down = (symbol->data[0] != '_');
+    Label *l = !down ? find_label2(symbol, cheap_context) : (hash >= 0) ? find_label_hashed(symbol, hash, NULL) : find_label(symbol, NULL);
+    Error *err;
+    if (l != NULL) {
+        if (diagnostics.case_symbol && str_cmp(symbol, &l->name) != 0) err_msg_symbol_case(symbol, l, epoint);
+        touch_label(l);
+        return val_reference(l->value);
+    }
+    if (constcreated && pass < max_pass) {
+        return ref_none();
+    }
+    err = new_error(ERROR___NOT_DEFINED, epoint);
+    err->u.notdef.symbol = new_symbol(symbol, epoint);
+    err->u.notdef.names = ref_namespace(down ? current_context : cheap_context);
+    err->u.notdef.down = down;
+    return Obj(err);
+}
+
+static bool get_exp_cached(const struct expcache_s *c) {
+    struct out_list_s out;
+    struct linepos_s epoint;
+    const struct expitem_s *i, *end = c->items + c->len;
+    str_t symbol;
+
+    epoint.line = lpoint.line;
+    out.p = out.data = eval->out.data;
+    out.max = eval->out.max;
+    for (i = c->items; i != end; i++) {
+        Obj *val;
+        epoint.pos = i->pos;
+        switch (i->kind) {
+        case EXP_LABEL:
+            symbol.data = pline + i->start;
+            symbol.len = i->len;
+            val = find_symbol(&symbol, i->u.hash, &epoint);
+            break;
+        case EXP_SYMBOL:
+            symbol.data = pline + i->start;
+            symbol.len = i->len;
+            val = new_symbol(&symbol, &epoint);
+            break;
+        case EXP_ANONSYMBOL: val = new_anonsymbol(i->u.as); break;
+        case EXP_ANONLABEL: val = resolv_anonlabel(i->u.as, i->pos); break;
+        case EXP_STAR: val = get_star(); break;
+        case EXP_STARSYMBOL: val = new_starsymbol(i->pos); break;
+        case EXP_OPER: val = &operators[i->u.op].v; break;
+        default: val = val_reference(i->u.val); break;
+        }
+        out.p->val = val;
+        out.p->pos = i->pos;
+        if (++out.p == out.max) extend_out(&out);
+    }
+    lpoint.pos = c->end;
+    eval->out.data = out.data;
+    eval->out.p = out.data;
+    eval->out.max = out.max;
+    eval->out.end = out.p;
+    return get_val2(eval);
+}
+
+static void expcache_store(struct file_s *cfile, linecpos_t pos, int stop, const struct out_list_s *out) {
+    struct expcache_s *c;
+    struct expcache_s **b;
+    argcount_t i, j, len = (argcount_t)(out->p - out->data);
+    linenum_t lnum = lpoint.line - 1;
+    if (len == 1 && exprecord.p == 1 && exprecord.data[0].item.kind == EXP_LABEL) return; /* nothing to gain */
+    c = expcache_alloc(len);
+    if (c == NULL) return;
+    if (cfile->expcache == NULL) {
+        new_array(&cfile->expcache, cfile->lines);
+        for (i = 0; i < cfile->lines; i++) cfile->expcache[i] = NULL;
+    }
+    c->pos = pos;
+    c->end = lpoint.pos;
+    c->stop = stop;
+    for (i = j = 0; i < len; i++) {
+        struct expitem_s *item = &c->items[i];
+        if (j < exprecord.p && exprecord.data[j].index == i) {
+            *item = exprecord.data[j++].item;
+            if (item->kind == EXP_LABEL) {
+                str_t symbol, cf;
+                symbol.data = pline + item->start;
+                symbol.len = item->len;
+                str_cfcpy(&cf, &symbol);
+                item->u.hash = (cf.data == symbol.data) ? str_hash(&cf) : -1;
+            }
+        } else if (out->data[i].val->obj == OPER_OBJ) {
+            item->kind = EXP_OPER;
+            item->u.op = Oper(out->data[i].val)->op;
+        } else {
+            item->kind = EXP_VALUE;
+            item->u.val = val_reference(out->data[i].val);
+        }
+        item->pos = out->data[i].pos;
+    }
+    b = &cfile->expcache[lnum];
+    c->next = *b;
+    *b = c;
+}
+
 static bool get_exp2(int stop) {
     uint8_t ch;
 
     Oper_types op;
     argcount_t db;
+    ssize_t as;
     unsigned int prec;
     struct linepos_s epoint;
     linecpos_t llen;
@@ -1393,6 +1613,8 @@ static bool get_exp2(int stop) {
     Obj *val;
     struct out_list_s out;
     struct opr_list_s opr;
+    struct file_s *cfile;
+    linecpos_t startpos = 0;
 
     clean_out(eval);
     eval->gstop = stop;
@@ -1410,6 +1632,15 @@ static bool get_exp2(int stop) {
         eval->out.p = eval->out.data;
         return true;
     }
+    cfile = expcache_file();
+    if (cfile != NULL) {
+        const struct expcache_s *c = expcache_lookup(cfile, stop);
+        if (c != NULL) return get_exp_cached(c);
+        if (expcache_seen(cfile)) {
+            startpos = lpoint.pos;
+            exprecord.p = 0;
+        } else cfile = NULL;
+    }
     symbollist = 0;
     epoint.line = lpoint.line;
     out.p = out.data = eval->out.data;
@@ -1492,7 +1723,10 @@ static bool get_exp2(int stop) {
         case '`': op = O_BANK; goto priocheck;
         case '^':
             op = O_STRING;
-            if (diagnostics.deprecated) err_msg2(ERROR____OLD_STRING, NULL, &lpoint);
+            if (diagnostics.deprecated) {
+                err_msg2(ERROR____OLD_STRING, NULL, &lpoint);
+                cfile = NULL;
+            }
         priocheck:
             if (diagnostics.priority && opr.p != opr.data && opr.p - 1 != opr.data && op == opr.p[-2].op) {
                 unsigned int prio = operators[opr.p[-1].op].prio;
@@ -1501,6 +1735,7 @@ static bool get_exp2(int stop) {
                     epoint2.line = lpoint.line;
                     epoint2.pos = opr.p[-2].pos;
                     err_msg_priority(&operators[op], &epoint2);
+                    cfile = NULL;
                 }
             }
             break;
@@ -1525,7 +1760,11 @@ static bool get_exp2(int stop) {
                 symbol.len = get_label(symbol.data);
                 if (symbol.len != 0) {
                     lpoint.pos += (linecpos_t)symbol.len + 1;
-                    if (symbol.len > 1 && symbol.data[0] == '_' && symbol.data[1] == '_') err_msg2(ERROR_RESERVED_LABL, &symbol, &epoint);
+                    if (symbol.len > 1 && symbol.data[0] == '_' && symbol.data[1] == '_') {
+                        err_msg2(ERROR_RESERVED_LABL, &symbol, &epoint);
+                        cfile = NULL;
+                    }
+                    if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_SYMBOL, (linecpos_t)(symbol.data - pline), (linecpos_t)symbol.len, 0);
                     val = new_symbol(&symbol, &epoint);
                     goto push_other;
                 }
@@ -1534,11 +1773,14 @@ static bool get_exp2(int stop) {
                 case '-':
                     while (symbol.data[0] == symbol.data[++symbol.len]);
                     lpoint.pos += (linecpos_t)symbol.len + 1;
-                    val = new_anonsymbol((symbol.data[0] == '+') ? ((ssize_t)symbol.len - 1) : -(ssize_t)symbol.len);
+                    as = (symbol.data[0] == '+') ? ((ssize_t)symbol.len - 1) : -(ssize_t)symbol.len;
+                    if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_ANONSYMBOL, 0, 0, as);
+                    val = new_anonsymbol(as);
                     goto push_other;
                 case '*':
                     lpoint.pos += 2;
                     symbol.len = 1;
+                    if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_SYMBOL, (linecpos_t)(symbol.data - pline), 1, 0);
                     val = new_symbol(&symbol, &epoint);
                     goto push_other;
                 case '(':
@@ -1563,7 +1805,10 @@ static bool get_exp2(int stop) {
             val = get_float(&epoint);
             goto push_other;
         case '0':
-            if (diagnostics.leading_zeros && (pline[lpoint.pos + 1] ^ 0x30) < 10) err_msg2(ERROR_LEADING_ZEROS, NULL, &lpoint);
+            if (diagnostics.leading_zeros && (pline[lpoint.pos + 1] ^ 0x30) < 10) {
+                err_msg2(ERROR_LEADING_ZEROS, NULL, &lpoint);
+                cfile = NULL;
+            }
             FALL_THROUGH; /* fall through */
         case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
             val = get_float(&epoint);
@@ -1574,8 +1819,6 @@ static bool get_exp2(int stop) {
         default:
             llen = (linecpos_t)get_label(pline + lpoint.pos);
             if (llen != 0) {
-                bool down;
-                Label *l;
                 str_t symbol;
                 lpoint.pos += llen;
             as_symbol:
@@ -1593,6 +1836,7 @@ static bool get_exp2(int stop) {
                     }
                     if (mode != BYTES_MODE_NULL_CHECK) {
                         Obj *str = get_string(&epoint);
+                        cfile = NULL; /* depends on the encoding */
                         if (str->obj == STR_OBJ) {
                             epoint.pos++;
                             val = bytes_from_str(Str(str), &epoint, mode);
@@ -1607,23 +1851,11 @@ static bool get_exp2(int stop) {
                 symbol.data = pline + epoint.pos;
                 symbol.len = lpoint.pos - epoint.pos;
                 if ((opr.p != opr.data && opr.p[-1].op == O_MEMBER) || symbollist != 0) {
+                    if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_SYMBOL, epoint.pos, (linecpos_t)symbol.len, 0);
                     val = new_symbol(&symbol, &epoint);
                 } else {
-                    down = (symbol.data[0] != '_');
-                    l = down ? find_label(&symbol, NULL) : find_label2(&symbol, cheap_context);
-                    if (l != NULL) {
-                        if (diagnostics.case_symbol && str_cmp(&symbol, &l->name) != 0) err_msg_symbol_case(&symbol, l, &epoint);
-                        touch_label(l);
-                        val = val_reference(l->value);
-                    } else if (constcreated && pass < max_pass) {
-                        val = ref_none();
-                    } else {
-                        Error *err = new_error(ERROR___NOT_DEFINED, &epoint);
-                        err->u.notdef.symbol = new_symbol(&symbol, &epoint);
-                        err->u.notdef.names = ref_namespace(down ? current_context : cheap_context);
-                        err->u.notdef.down = down;
-                        val = Obj(err);
-                    }
+                    if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_LABEL, epoint.pos, (linecpos_t)symbol.len, 0);
+                    val = find_symbol(&symbol, -1, &epoint);
                 }
                 goto push_other;
             }
@@ -1631,10 +1863,12 @@ static bool get_exp2(int stop) {
             db = 0;
             while (opr.p != opr.data && opr.p[-1].op == O_POS) {opr.p--; db++;}
             if (db != 0) {
-                ssize_t as = (ssize_t)db - 1;
+                as = (ssize_t)db - 1;
                 if ((opr.p != opr.data && opr.p[-1].op == O_MEMBER) || symbollist != 0) {
+                    if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_ANONSYMBOL, 0, 0, as);
                     val = new_anonsymbol(as);
                 } else {
+                    if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_ANONLABEL, 0, 0, as);
                     val = resolv_anonlabel(as, opr.p->pos);
                 }
                 epoint.pos = opr.p->pos;
@@ -1642,10 +1876,12 @@ static bool get_exp2(int stop) {
             }
             while (opr.p != opr.data && opr.p[-1].op == O_NEG) {opr.p--; db++;}
             if (db != 0) {
-                ssize_t as = -(ssize_t)db;
+                as = -(ssize_t)db;
                 if ((opr.p != opr.data && opr.p[-1].op == O_MEMBER) || symbollist != 0) {
+                    if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_ANONSYMBOL, 0, 0, as);
                     val = new_anonsymbol(as);
                 } else {
+                    if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_ANONLABEL, 0, 0, as);
                     val = resolv_anonlabel(as, opr.p->pos);
                 }
                 epoint.pos = opr.p->pos;
@@ -1659,8 +1895,10 @@ static bool get_exp2(int stop) {
                 if (opr.p[-1].op == O_SPLAT) {
                     opr.p--;
                     if ((opr.p != opr.data && opr.p[-1].op == O_MEMBER) || symbollist != 0) {
+                        if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_STARSYMBOL, 0, 0, 0);
                         val = new_starsymbol(opr.p->pos);
                     } else {
+                        if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_STAR, 0, 0, 0);
                         val = get_star();
                     }
                     epoint.pos = opr.p->pos;
@@ -1676,8 +1914,10 @@ static bool get_exp2(int stop) {
             opr.p--;
             lpoint.pos = epoint.pos;
             if ((opr.p != opr.data && opr.p[-1].op == O_MEMBER) || symbollist != 0) {
+                if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_STARSYMBOL, 0, 0, 0);
                 val = new_starsymbol(opr.p->pos);
             } else {
+                if (cfile != NULL) exprecord_add((argcount_t)(out.p - out.data), EXP_STAR, 0, 0, 0);
                 val = get_star();
             }
             epoint.pos = opr.p->pos;
@@ -1690,6 +1930,7 @@ static bool get_exp2(int stop) {
         if (++opr.p == opr.max) extend_opr(&opr);
         continue;
     push_other:
+        if (cfile != NULL && val->obj == ERROR_OBJ && (exprecord.p == 0 || exprecord.data[exprecord.p - 1].index != (argcount_t)(out.p - out.data))) cfile = NULL;
         out.p->val = val;
         out.p->pos = epoint.pos;
         if (++out.p == out.max) extend_out(&out);
@@ -1794,7 +2035,7 @@ static bool get_exp2(int stop) {
         case '^': op = pline[lpoint.pos + 1] == '^' ? O_LXOR : (pline[lpoint.pos + 1] == '=' ? O_XOR_ASSIGN : O_XOR); goto push2;
         case '*': op = pline[lpoint.pos + 1] == '*' ? (pline[lpoint.pos + 2] == '=' ? O_EXP_ASSIGN : O_EXP) : (pline[lpoint.pos + 1] == '=' ? O_MUL_ASSIGN : O_MUL); if (op == O_EXP) {lpoint.pos+=2; goto rtl;} goto push2;
         case '%': op = pline[lpoint.pos + 1] == '=' ? O_MOD_ASSIGN : O_MOD; goto push2;
-        case '/': if (pline[lpoint.pos + 1] == '/') {if (diagnostics.deprecated) err_msg2(ERROR____OLD_MODULO, NULL, &lpoint);lpoint.pos++;op = O_MOD;} else op = pline[lpoint.pos + 1] == '=' ? O_DIV_ASSIGN : O_DIV; goto push2;
+        case '/': if (pline[lpoint.pos + 1] == '/') {if (diagnostics.deprecated) {err_msg2(ERROR____OLD_MODULO, NULL, &lpoint); cfile = NULL;} lpoint.pos++;op = O_MOD;} else op = pline[lpoint.pos + 1] == '=' ? O_DIV_ASSIGN : O_DIV; goto push2;
         case '+': op = pline[lpoint.pos + 1] == '=' ? O_ADD_ASSIGN : O_ADD; goto push2;
         case '-': op = pline[lpoint.pos + 1] == '=' ? O_SUB_ASSIGN : O_SUB; goto push2;
         case '.': op = pline[lpoint.pos + 1] == '.' ? (pline[lpoint.pos + 2] == '=' ? O_CONCAT_ASSIGN : O_CONCAT) : (pline[lpoint.pos + 1] == '=' ? O_MEMBER_ASSIGN : O_MEMBER); goto push2;
@@ -1836,7 +2077,10 @@ static bool get_exp2(int stop) {
                 if (opr.p == opr.data) {
                     if (stop == 5) break;
                 }
-                if (diagnostics.old_equal) err_msg2(ERROR_____OLD_EQUAL, NULL, &lpoint);
+                if (diagnostics.old_equal) {
+                    err_msg2(ERROR_____OLD_EQUAL, NULL, &lpoint);
+                    cfile = NULL;
+                }
                 lpoint.pos++;
                 opr.p->op = op;
                 opr.p->pos = epoint.pos;
@@ -1863,7 +2107,7 @@ static bool get_exp2(int stop) {
             continue;
         case '<':
             switch (pline[lpoint.pos + 1]) {
-            case '>': if (diagnostics.deprecated) err_msg2(ERROR_______OLD_NEQ, NULL, &lpoint); op = O_NE; break;
+            case '>': if (diagnostics.deprecated) {err_msg2(ERROR_______OLD_NEQ, NULL, &lpoint); cfile = NULL;} op = O_NE; break;
             case '<': op = pline[lpoint.pos + 2] == '=' ? O_BLS_ASSIGN : O_LSHIFT; break;
             case '?': op = pline[lpoint.pos + 2] == '=' ? O_MIN_ASSIGN : O_MIN; break;
             case '=': op = pline[lpoint.pos + 2] == '>' ? O_CMP : O_LE; break;
@@ -1872,7 +2116,7 @@ static bool get_exp2(int stop) {
             goto push2;
         case '>':
             switch (pline[lpoint.pos + 1]) {
-            case '<': if (diagnostics.deprecated) err_msg2(ERROR_______OLD_NEQ, NULL, &lpoint); op = O_NE; break;
+            case '<': if (diagnostics.deprecated) {err_msg2(ERROR_______OLD_NEQ, NULL, &lpoint); cfile = NULL;} op = O_NE; break;
             case '>': op = pline[lpoint.pos + 2] == '=' ? O_BRS_ASSIGN : O_RSHIFT; break;
             case '?': op = pline[lpoint.pos + 2] == '=' ? O_MAX_ASSIGN : O_MAX; break;
             case '=': op = O_GE; break;
@@ -2009,6 +2253,7 @@ static bool get_exp2(int stop) {
         eval->out.p = out.data;
         eval->out.max = out.max;
         eval->out.end = out.p;
+        if (cfile != NULL) expcache_store(cfile, startpos, stop, &out);
         return get_val2(eval);
     error:
         break;
@@ -2023,7 +2268,11 @@ static bool get_exp2(int stop) {
 }
 
 bool get_exp(int stop, argcount_t min, argcount_t max, linepos_t epoint) {/* length in bytes, defined */
-    if (!get_exp2(stop)) {
+    bool ret;
+    profile_enter(PROFILE_EVAL);
+    ret = get_exp2(stop);
+    profile_leave();
+    if (!ret) {
         return false;
     }
     if (eval->values_len < min || (max != 0 && eval->values_len > max)) {
@@ -2097,6 +2346,10 @@ void eval_leave(void) {
 }
 
 void init_eval(void) {
+    expcache.chunks = NULL;
+    exprecord.data = NULL;
+    exprecord.p = 0;
+    exprecord.len = 0;
     evx = NULL;
     evxnum = 0;
     evx_p = ~(size_t)0;
@@ -2104,6 +2357,21 @@ void init_eval(void) {
 }
 
 void destroy_eval(void) {
+    while (expcache.chunks != NULL) {
+        struct expchunk_s *chunk = expcache.chunks;
+        size_t i = 0;
+        while (i < chunk->len) {
+            struct expcache_s *c = (struct expcache_s *)(chunk->u.data + i);
+            argcount_t j;
+            for (j = 0; j < c->len; j++) {
+                if (c->items[j].kind == EXP_VALUE) val_destroy(c->items[j].u.val);
+            }
+            i += expcache_size(c->len);
+        }
+        expcache.chunks = chunk->next;
+        free(chunk);
+    }
+    free(exprecord.data);
     while ((evxnum--) != 0) {
         struct values_s *v;
         eval = evx[evxnum];
@@ -37,6 +37,10 @@
 #elif defined _POSIX_C_SOURCE || defined __unix__ || defined __HAIKU__
 #include <sys/stat.h>
 #define STAT_AVAILABLE
+#if defined _POSIX_MAPPED_FILES && _POSIX_MAPPED_FILES > 0
+#include <sys/mman.h>
+#define MMAP_AVAILABLE
+#endif
 #endif
 #include "64tass.h"
 #include "unicode.h"
@@ -244,18 +248,39 @@ static bool portability2(const str_t *name, const char *realname, linepos_t epoi
 }
 #endif
 
+static void file_data_free(struct file_data_s *file) {
+#ifdef MMAP_AVAILABLE
+    if (file->mapped) {
+        munmap(file->data, file->len);
+        file->mapped = false;
+    } else
+#endif
+    free(file->data);
+    file->data = NULL;
+    file->len = 0;
+}
+
 static void file_free_static(struct file_s *a)
 {
     free(a->source.data);
-    free(a->binary.data);
+    file_data_free(&a->binary);
     free(a->line);
     free(a->nomacro);
+    if (a->mtemplate != NULL) {
+        linenum_t i;
+        for (i = 0; i < a->lines; i++) free(a->mtemplate[i]);
+        free(a->mtemplate);
+    }
+    free(a->expcache);
+    free(a->expseen);
     a->source.data = NULL;
     a->source.read = false;
-    a->binary.data = NULL;
     a->binary.read = false;
     a->line = NULL;
     a->nomacro = NULL;
+    a->mtemplate = NULL;
+    a->expcache = NULL;
+    a->expseen = NULL;
 }
 
 static void file_free(struct file_s *a)
@@ -345,10 +370,27 @@ static filesize_t fsize(FILE *f) {
     return 0;
 }
 
+#ifdef MMAP_AVAILABLE
+static bool map_binary(struct file_data_s *file, FILE *f, filesize_t fs) {
+    void *d;
+    if (fs < 65536 || fs == ~(filesize_t)0) return true; /* not worth it */
+    d = mmap(NULL, fs, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+    if (d == MAP_FAILED) return true;
+    file->data = (uint8_t *)d;
+    file->len = fs;
+    file->read = true;
+    file->mapped = true;
+    return false;
+}
+#endif
+
 static int read_binary(struct file_data_s *file, FILE *f) {
     filesize_t fp = 0;
     int err = 1;
     filesize_t fs = fsize(f);
+#ifdef MMAP_AVAILABLE
+    if (fs > 0 && !map_binary(file, f, fs)) return 0;
+#endif
     if (fs > 0) {
         file->data = allocate_array(uint8_t, fs);
         if (file->data != NULL) file->len = fs;
@@ -380,6 +422,29 @@ static int read_binary(struct file_data_s *file, FILE *f) {
     return err;
 }
 
+#define ASCII_ONES (~(size_t)0 / 255)
+#define ASCII_HIGHS (ASCII_ONES * 0x80)
+
+static inline size_t ascii_zeros(size_t v) {
+    return (v - ASCII_ONES) & ~v & ASCII_HIGHS;
+}
+
+/* Length of leading bytes which need no decoding (not NUL, CR, LF or 8 bit) */
+static filesize_t ascii_run(const uint8_t *s, filesize_t len) {
+    filesize_t i = 0;
+    while (i + sizeof(size_t) <= len) {
+        size_t v;
+        memcpy(&v, s + i, sizeof v);
+        if (((v | ascii_zeros(v) | ascii_zeros(v ^ (ASCII_ONES * 10)) | ascii_zeros(v ^ (ASCII_ONES * 13))) & ASCII_HIGHS) != 0) break;
+        i += (filesize_t)sizeof v;
+    }
+    for (; i < len; i++) {
+        uint8_t ch = s[i];
+        if (ch >= 0x80 || ch == 0 || ch == 10 || ch == 13) break;
+    }
+    return i;
+}
+
 static struct ubuff_s last_ubuff;
 static int read_source(struct file_s *file, FILE *f) {
     enum { REPLACEMENT_CHARACTER = 0xfffd };
@@ -444,8 +509,8 @@ static int read_source(struct file_s *file, FILE *f) {
                         if (rl > 0) {
                             memcpy(buffer + BUFSIZ, file->binary.data + bfp, rl);
                             bfp += rl;
+                            bl = BUFSIZ + rl;
                         }
-                        bl = BUFSIZ + rl;
                     } else {
                         if (feof(f) == 0) bl = BUFSIZ + (filesize_t)fread(buffer + BUFSIZ, 1, BUFSIZ, f);
                     }
@@ -457,8 +522,8 @@ static int read_source(struct file_s *file, FILE *f) {
                         if (rl > 0) {
                             memcpy(buffer, file->binary.data + bfp, rl);
                             bfp += rl;
-                        }
-                        bl = rl;
+                            bl = rl;
+                        } else if (bl == BUFSIZ * 2) bl = 0;
                     } else {
                         if (feof(f) == 0) bl = (filesize_t)fread(buffer, 1, BUFSIZ, f);
                     }
@@ -466,6 +531,29 @@ static int read_source(struct file_s *file, FILE *f) {
                 if (signal_received) bl = bp;
             }
             if (bp == bl) break;
+            if (encoding != E_UTF16LE && encoding != E_UTF16BE && (encoding == E_RAW || (qc && ubuff.p == 1 && ubuff.data[0] != 0 && ubuff.data[0] < 0x80))) {
+                filesize_t n, limit = (bp / (BUFSIZ / 2) + 1) * (BUFSIZ / 2);
+                if (bp < bl && bl < limit) limit = bl;
+                n = ascii_run(buffer + bp, limit - bp);
+                if (n > 1) {
+                    while (p + n + 6*6 + 1 > file->source.len) {
+                        if (file_extend(&file->source)) goto failed;
+                    }
+                    c = buffer[bp + n - 1];
+                    if (encoding != E_RAW) {
+                        file->source.data[p++] = (uint8_t)ubuff.data[0];
+                        ubuff.data[0] = c;
+                        cclass = 0;
+                        memcpy(file->source.data + p, buffer + bp, n - 1);
+                        p += n - 1;
+                    } else {
+                        memcpy(file->source.data + p, buffer + bp, n);
+                        p += n;
+                    }
+                    bp = (bp + n) % (BUFSIZ * 2);
+                    continue;
+                }
+            }
             lastchar = c;
             c = buffer[bp]; bp = (bp + 1) % (BUFSIZ * 2);
             switch (encoding) {
@@ -674,6 +762,28 @@ static FILE *file_fopen(struct file_s *file) {
     return f;
 }
 
+struct file_buffer_s *file_buffers;
+
+static void file_buffer(struct file_s *file) {
+    const struct file_buffer_s *b;
+    for (b = file_buffers; b != NULL; b = b->next) {
+        if (strcmp(b->name, file->name) != 0) continue;
+        file->binary.len = (b->len & ~(size_t)~(filesize_t)0) == 0 ? (filesize_t)b->len : ~(filesize_t)0;
+        if (file->binary.len != 0) {
+            file->binary.data = allocate_array(uint8_t, file->binary.len);
+            if (file->binary.data == NULL) {
+                file->binary.len = 0;
+                file->err_no = ENOMEM;
+                return;
+            }
+            memcpy(file->binary.data, b->data, file->binary.len);
+        }
+        file->read_error = true;
+        file->binary.read = true;
+        return;
+    }
+}
+
 static struct file_s *lastfi;
 static struct file_s *file_lookup(const str_t *name, const char *base) {
     struct file_s *file;
@@ -688,6 +798,9 @@ static struct file_s *file_lookup(const str_t *name, const char *base) {
         file = lastfi;
         lastfi = NULL;
         file->nomacro = NULL;
+        file->mtemplate = NULL;
+        file->expcache = NULL;
+        file->expseen = NULL;
         file->line = NULL;
         file->lines = 0;
         file->source.data = NULL;
@@ -696,6 +809,7 @@ static struct file_s *file_lookup(const str_t *name, const char *base) {
         file->binary.data = NULL;
         file->binary.len = 0;
         file->binary.read = false;
+        file->binary.mapped = false;
         file->open = 0;
         file->err_no = 0;
         file->read_error = false;
@@ -706,6 +820,7 @@ static struct file_s *file_lookup(const str_t *name, const char *base) {
         file->uid = 0;
         file->entercount = 0;
         file->encoding = E_UNKNOWN;
+        if (file_buffers != NULL) file_buffer(file);
     } else {
         free((char *)lastfi->name);
     }
@@ -794,9 +909,7 @@ struct file_s *file_open(const str_t *name, const struct file_list_s *cfile, Fil
     }
     if (err != 0) {
         if (ftype == FILE_OPEN_BINARY) {
-            free(file->binary.data);
-            file->binary.data = NULL;
-            file->binary.len = 0;
+            file_data_free(&file->binary);
         } else {
             free(file->source.data);
             file->source.data = NULL;
@@ -862,6 +975,8 @@ struct star_s *new_star(linenum_t line) {
         lastst = &stars->stars[starsp];
         tmp->star.pass = 0;
         tmp->star.vline = 0;
+        tmp->star.branch = 0;
+        tmp->star.branchpass = 0;
         return &tmp->star;
     }
     tmp = avltree_container_of(b, struct starnode_s, node);
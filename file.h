@@ -33,16 +33,23 @@ typedef enum File_open_type {
 
 typedef uint32_t filesize_t;
 
+struct macro_template_s;
+struct expcache_s;
+
 struct file_data_s {
     uint8_t *data;
     filesize_t len;
     bool read;
+    bool mapped;
 };
 
 struct file_s {
     const char *name;
     int hash;
     uint8_t *nomacro;
+    struct macro_template_s **mtemplate;
+    struct expcache_s **expcache;
+    uint8_t *expseen;
     filesize_t *line;
     linenum_t lines;
     struct file_data_s source;
@@ -61,15 +68,25 @@ struct file_s {
 
 #define not_in_file(a, b) ((size_t)((a) - (1 ? (b) : (struct file_s *)(void *)(b))->source.data) >= (b)->source.len)
 
+struct file_buffer_s {
+    const char *name;
+    const uint8_t *data;
+    size_t len;
+    struct file_buffer_s *next;
+};
+
 struct star_s {
     linenum_t line, vline;
     address_t addr;
     uint8_t pass;
+    uint8_t branch, branchpass;
 };
 
 struct str_t;
 struct file_list_s;
 
+extern struct file_buffer_s *file_buffers;
+
 extern struct file_s *file_open(const struct str_t *, const struct file_list_s *, File_open_type, linepos_t);
 extern struct star_s *new_star(linenum_t);
 extern struct star_s *init_star(linenum_t);
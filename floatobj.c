@@ -360,6 +360,60 @@ static MUST_CHECK Obj *calc2_double(oper_t op) {
     return obj_oper_error(op);
 }
 
+/* Collects the values of floats and single digit integers, which are exact
+   as doubles. Anything else is refused. */
+bool float_array_from_objs(double *d, Obj *const *vals, size_t len, bool *allfloat) {
+    size_t i;
+    bool f = true;
+    for (i = 0; i < len; i++) {
+        const Obj *o1 = vals[i];
+        if (o1->obj == FLOAT_OBJ) {
+            d[i] = Float(o1)->real;
+            continue;
+        }
+        if (o1->obj != INT_OBJ) return false;
+        switch (Int(o1)->len) {
+        case -1: d[i] = -(double)Int(o1)->data[0]; break;
+        case 0: d[i] = 0.0; break;
+        case 1: d[i] = Int(o1)->data[0]; break;
+        default: return false;
+        }
+        f = false;
+    }
+    *allfloat = f;
+    return true;
+}
+
+bool float_array_finite(const double *d, size_t len) {
+    size_t i;
+    double r = 0.0;
+    for (i = 0; i < len; i++) r += d[i] * 0.0; /* NaN for infinities and NaN */
+    return r == 0.0;
+}
+
+/* Elementwise arithmetic, a missing array is replaced by the scalar. Fails
+   if the operation is not supported or a result is not finite. */
+bool float_array_calc2(Oper_types op, double *d, const double *d1, double s1, const double *d2, double s2, size_t len) {
+    size_t i;
+    switch (op) {
+    case O_ADD:
+        for (i = 0; i < len; i++) d[i] = ((d1 != NULL) ? d1[i] : s1) + ((d2 != NULL) ? d2[i] : s2);
+        break;
+    case O_SUB:
+        for (i = 0; i < len; i++) d[i] = ((d1 != NULL) ? d1[i] : s1) - ((d2 != NULL) ? d2[i] : s2);
+        break;
+    case O_MUL:
+        for (i = 0; i < len; i++) d[i] = ((d1 != NULL) ? d1[i] : s1) * ((d2 != NULL) ? d2[i] : s2);
+        break;
+    case O_DIV:
+        for (i = 0; i < len; i++) d[i] = ((d1 != NULL) ? d1[i] : s1) / ((d2 != NULL) ? d2[i] : s2);
+        break;
+    default:
+        return false;
+    }
+    return float_array_finite(d, len);
+}
+
 MUST_CHECK Obj *float_from_double(double d, linepos_t epoint) {
     if (d == HUGE_VAL || d == -HUGE_VAL || d != d) {
         return Obj(new_error(ERROR_NUMERIC_OVERF, epoint));
@@ -20,6 +20,8 @@
 #define FLOATOBJ_H
 #include "obj.h"
 #include "values.h"
+#include "oper_e.h"
+#include "stdbool.h"
 
 extern struct Type *const FLOAT_OBJ;
 
@@ -44,5 +46,8 @@ struct oper_s;
 
 extern MUST_CHECK Obj *float_from_double(double, linepos_t);
 extern MUST_CHECK Obj *float_from_obj(Obj *, linepos_t);
+extern bool float_array_from_objs(double *, Obj *const *, size_t, bool *);
+extern bool float_array_finite(const double *, size_t);
+extern bool float_array_calc2(Oper_types, double *, const double *, double, const double *, double, size_t);
 
 #endif
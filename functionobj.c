@@ -28,10 +28,12 @@
 #include "instruction.h"
 #include "64tass.h"
 #include "section.h"
+#include "macro.h"
 
 #include "floatobj.h"
 #include "strobj.h"
 #include "listobj.h"
+#include "rangeobj.h"
 #include "intobj.h"
 #include "boolobj.h"
 #include "typeobj.h"
@@ -181,11 +183,9 @@ failed:
 static MUST_CHECK Obj *function_range(oper_t op) {
     Funcargs *vals = Funcargs(op->v2);
     struct values_s *v = vals->val;
-    List *new_value;
     Error *err = NULL;
     ival_t start = 0, end, step = 1;
-    size_t len2, i;
-    Obj **val;
+    uval_t len2;
 
     switch (vals->len) {
     default: end = 0; break; /* impossible */
@@ -207,21 +207,11 @@ static MUST_CHECK Obj *function_range(oper_t op) {
         return Obj(new_error(ERROR_NO_ZERO_VALUE, &v[2].epoint));
     }
     if (step > 0) {
-        if (end < start) end = start;
-        len2 = (uval_t)(end - start + step - 1) / (uval_t)step;
+        len2 = (end > start) ? ((uval_t)end - (uval_t)start - 1) / (uval_t)step + 1 : 0;
     } else {
-        if (end > start) end = start;
-        len2 = (uval_t)(start - end - step - 1) / -(uval_t)step;
+        len2 = (end < start) ? ((uval_t)start - (uval_t)end - 1) / -(uval_t)step + 1 : 0;
     }
-    new_value = new_list();
-    val = list_create_elements(new_value, len2);
-    for (i = 0; i < len2; i++) {
-        val[i] = int_from_ival(start);
-        start += step;
-    }
-    new_value->len = len2;
-    new_value->data = val;
-    return Obj(new_value);
+    return new_range(start, step, len2);
 }
 
 static uint64_t state[2];
@@ -276,6 +266,7 @@ static MUST_CHECK Obj *function_random(oper_t op) {
     ival_t start = 0, end, step = 1;
     uval_t len2;
 
+    function_impure(PURITY_NONE);
     switch (vals->len) {
     default:
         return new_float((double)(int64_t)(random64() & (((uint64_t)1 << 53) - 1)) * ldexp(1, -53));
@@ -387,6 +378,14 @@ static int dict_sortcomp(const void *a, const void *b) {
 
 /* sort() */
 static MUST_CHECK Obj *function_sort(Obj *o1, linepos_t epoint) {
+    if (o1->obj == RANGE_OBJ) {
+        Obj *list;
+        if (Range(o1)->step > 0) return val_reference(o1);
+        list = list_from_range(Range(o1));
+        o1 = function_sort(list, epoint);
+        val_destroy(list);
+        return o1;
+    }
     if (o1->obj == TUPLE_OBJ || o1->obj == LIST_OBJ || o1->obj == DICT_OBJ) {
         size_t ln = (o1->obj == DICT_OBJ) ? Dict(o1)->len : List(o1)->len;
         if (ln > 1) {
@@ -483,7 +482,9 @@ static Obj *function_rta_addr(oper_t op, bool rta) {
     uval_t uv;
     Obj *val = op->v2;
     atype_t am = val->obj->address(val);
-    Error *err = val->obj->uaddress(val, &uv, (am == A_KR) ? 16 : all_mem_bits, op->epoint2);
+    Error *err;
+    function_impure(PURITY_NONE);
+    err = val->obj->uaddress(val, &uv, (am == A_KR) ? 16 : all_mem_bits, op->epoint2);
     if (err != NULL) return Obj(err);
     uv &= all_mem;
     switch (am) {
@@ -499,6 +500,34 @@ static Obj *function_rta_addr(oper_t op, bool rta) {
     return bytes_from_uval(uv, 2);
 }
 
+/* Float result of a function, domain errors are checked by the callers */
+static inline double float_function(Function_types func, double real) {
+    switch (func) {
+    case F_SQRT: return sqrt(real);
+    case F_LOG10: return log10(real);
+    case F_EXP: return exp(real);
+    case F_SIN: return sin(real);
+    case F_COS: return cos(real);
+    case F_TAN: return tan(real);
+    case F_ACOS: return acos(real);
+    case F_ASIN: return asin(real);
+    case F_ATAN: return atan(real);
+    case F_CBRT: return cbrt(real);
+    case F_FRAC: return real - trunc(real);
+    case F_RAD: return real * M_PI / 180.0;
+    case F_DEG: return real * 180.0 / M_PI;
+    case F_COSH: return cosh(real);
+    case F_SINH: return sinh(real);
+    case F_TANH: return tanh(real);
+    case F_CEIL: return ceil(real);
+    case F_FLOOR: return floor(real);
+    case F_ROUND: return round(real);
+    case F_TRUNC: return trunc(real);
+    case F_ABS: return (real < 0.0) ? -real : real;
+    default: return HUGE_VAL; /* can't happen */
+    }
+}
+
 static MUST_CHECK Obj *function_function(oper_t op) {
     Obj *o2 = op->v2;
     const Type *typ = o2->obj;
@@ -541,40 +570,21 @@ static MUST_CHECK Obj *function_function(oper_t op) {
         if (real < 0.0) {
             err = ERROR_SQUARE_ROOT_N; goto failed;
         }
-        real = sqrt(real);
         break;
     case F_LOG10:
         if (real <= 0.0) {
             err = ERROR_LOG_NON_POSIT; goto failed;
         }
-        real = log10(real);
         break;
-    case F_EXP: real = exp(real);break;
-    case F_SIN: real = sin(real);break;
-    case F_COS: real = cos(real);break;
-    case F_TAN: real = tan(real);break;
     case F_ACOS:
-        if (real < -1.0 || real > 1.0) {
-            err = ERROR___MATH_DOMAIN; goto failed;
-        }
-        real = acos(real);
-        break;
     case F_ASIN:
         if (real < -1.0 || real > 1.0) {
             err = ERROR___MATH_DOMAIN; goto failed;
         }
-        real = asin(real);
         break;
-    case F_ATAN: real = atan(real);break;
-    case F_CBRT: real = cbrt(real);break;
-    case F_FRAC: real -= trunc(real);break;
-    case F_RAD: real = real * M_PI / 180.0;break;
-    case F_DEG: real = real * 180.0 / M_PI;break;
-    case F_COSH: real = cosh(real);break;
-    case F_SINH: real = sinh(real);break;
-    case F_TANH: real = tanh(real);break;
-    default: real = HUGE_VAL; break; /* can't happen */
+    default: break;
     }
+    real = float_function(Function(op->v1)->func, real);
     if (!inplace || real == HUGE_VAL || real == -HUGE_VAL || real != real) {
         if (typ != FLOAT_OBJ) val_destroy(o2);
         return float_from_double(real, op->epoint2);
@@ -586,6 +596,70 @@ failed:
     return new_error_obj(err, op->v2, op->epoint2);
 }
 
+/* Applies a float function on a whole list or range at once. Returns NULL
+   if it must be done elementwise. */
+static MUST_CHECK Obj *function_function_array(oper_t op) {
+    Obj *o2 = op->v2, *result;
+    Function_types func = Function(op->v1)->func;
+    size_t i, len;
+    double *d;
+    bool allfloat;
+
+    switch (func) {
+    case F_SQRT:
+    case F_LOG10:
+    case F_EXP:
+    case F_SIN:
+    case F_COS:
+    case F_TAN:
+    case F_ACOS:
+    case F_ASIN:
+    case F_ATAN:
+    case F_CBRT:
+    case F_FRAC:
+    case F_RAD:
+    case F_DEG:
+    case F_COSH:
+    case F_SINH:
+    case F_TANH:
+    case F_CEIL:
+    case F_FLOOR:
+    case F_ROUND:
+    case F_TRUNC:
+    case F_ABS:
+        break;
+    default:
+        return NULL;
+    }
+    len = (o2->obj == RANGE_OBJ) ? Range(o2)->len : List(o2)->len;
+    if (len == 0) return NULL;
+    d = allocate_array(double, len);
+    if (d == NULL) return NULL;
+    if (o2->obj == RANGE_OBJ) {
+        for (i = 0; i < len; i++) d[i] = range_element(Range(o2), (uval_t)i);
+        allfloat = false;
+    } else if (!float_array_from_objs(d, List(o2)->data, len, &allfloat)) goto failed;
+    switch (func) {
+    case F_CEIL:
+    case F_FLOOR:
+    case F_ROUND:
+    case F_TRUNC:
+    case F_ABS:
+        if (!allfloat) goto failed; /* these keep integers */
+        break;
+    default: break;
+    }
+    for (i = 0; i < len; i++) d[i] = float_function(func, d[i]);
+    /* domain errors and overflows are reported elementwise */
+    if (!float_array_finite(d, len)) goto failed;
+    result = list_from_doubles((o2->obj == TUPLE_OBJ) ? TUPLE_OBJ : LIST_OBJ, (op->inplace == o2 && o2->obj != RANGE_OBJ) ? List(o2) : NULL, d, len, op->epoint2);
+    free(d);
+    return result;
+failed:
+    free(d);
+    return NULL;
+}
+
 static MUST_CHECK Obj *apply_func(oper_t op, apply_func_t f) {
     Obj *o2 = op->v2;
     const Type *typ = o2->obj;
@@ -596,6 +670,10 @@ static MUST_CHECK Obj *apply_func(oper_t op, apply_func_t f) {
         size_t i, len;
         Obj **vals;
 
+        if (f == function_function && (typ == LIST_OBJ || typ == TUPLE_OBJ || typ == RANGE_OBJ)) {
+            Obj *result = function_function_array(op);
+            if (result != NULL) return result;
+        }
         if (!inplace || (typ != TUPLE_OBJ && typ != LIST_OBJ)) {
             struct iter_s iter;
             iter.data = o2; typ->getiter(&iter);
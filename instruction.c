@@ -27,6 +27,8 @@
 #include "longjump.h"
 #include "arguments.h"
 #include "optimizer.h"
+#include "profile.h"
+#include "passtrace.h"
 
 #include "addressobj.h"
 #include "listobj.h"
@@ -39,8 +41,10 @@
 #include "eval.h"
 
 static const uint32_t *mnemonic;    /* mnemonics */
+static const uint8_t *mnemonic_hash;
+static uint32_t mnemonic_mul;
 static const uint16_t *opcode;      /* opcodes */
-static unsigned int last_mnem;
+static uint8_t pinpass;             /* last pass a branch was kept long */
 
 bool longaccu, longindex, autosize; /* hack */
 uint32_t dpage;
@@ -49,26 +53,36 @@ bool longbranchasjmp;
 bool allowslowbranch;
 
 int lookup_opcode(const uint8_t *s) {
-    int32_t s4;
-    unsigned int also, felso, elozo, no;
-    int32_t name;
+    uint32_t name;
+    unsigned int no;
 
-    name = (s[0] << 16) | (s[1] << 8) | s[2];
+    name = ((uint32_t)s[0] << 16) | ((uint32_t)s[1] << 8) | s[2];
     if (arguments.caseinsensitive != 0) name |= 0x202020;
-    also = 0;
-    no = (felso = last_mnem) / 2;
-    for (;;) {  /* do binary search */
-        if ((s4 = name - (int32_t)mnemonic[no]) == 0) return (int)no;
-        elozo = no;
-        if (elozo == (no = ((s4 > 0) ? (felso + (also = no)) : (also + (felso = no))) / 2)) break;
-    }
-    return -1;
+    no = mnemonic_hash[(uint32_t)(name * mnemonic_mul) >> (32 - MNEMONIC_HASH_BITS)];
+    if (no == 0 || mnemonic[no - 1] != name) return -1;
+    return (int)no - 1;
+}
+
+void init_instruction(void) {
+    pinpass = 0;
 }
 
 void select_opcodes(const struct cpu_s *cpumode) {
-    last_mnem = cpumode->opcodes;
     mnemonic = cpumode->mnemonic;
+    mnemonic_hash = cpumode->mnemonic_hash;
+    mnemonic_mul = cpumode->mnemonic_mul;
     opcode = cpumode->opcode;
+#ifdef DEBUG
+    {
+        unsigned int i;
+        for (i = 0; i < cpumode->opcodes; i++) {
+            uint32_t name = mnemonic[i];
+            if (mnemonic_hash[(uint32_t)(name * mnemonic_mul) >> (32 - MNEMONIC_HASH_BITS)] != i + 1) {
+                fprintf(stderr, "%s mnemonic %06" PRIx32 " is not in its hash slot\n", cpumode->name, name);
+            }
+        }
+    }
+#endif
 }
 
 MUST_CHECK bool touval(Obj *v1, uval_t *uv, unsigned int bits, linepos_t epoint) {
@@ -133,7 +147,11 @@ static MUST_CHECK Error *err_addressize(Error_types no, linepos_t epoint, int pr
 }
 
 static void dump_instr(unsigned int cod, uint32_t adr, int ln, linepos_t epoint)  {
-    if (diagnostics.optimize) cpu_opt((uint8_t)cod, adr, ln, epoint);
+    if (diagnostics.optimize) {
+        profile_enter(PROFILE_OPTIMIZE);
+        cpu_opt((uint8_t)cod, adr, ln, epoint);
+        profile_leave();
+    }
     if (ln >= 0) {
         uint8_t *d;
         uint32_t temp;
@@ -446,6 +464,28 @@ static void qprefix(int prm, linepos_t epoint) {
     }
 }
 
+/* The last 4 short/long decisions of a branch are kept below a marker bit.
+   If it alternated all the time it'll never settle so it's kept long. Only
+   one is changed per pass as the others might just follow it. */
+static bool branch_far(struct star_s *s, bool far, linepos_t epoint) {
+    if (s->branchpass != pass) {
+        if (s->branch != 0xff) {
+            unsigned int h = (s->branch != 0 && (uint8_t)(s->branchpass + 1) == pass) ? s->branch : 1;
+            h = (h << 1) | (far ? 1 : 0);
+            if (h >= 0x20) h = (h & 0x0f) | 0x10;
+            if ((h == 0x15 || h == 0x1a) && pinpass != pass) {
+                pinpass = pass;
+                h = 0xff;
+            }
+            s->branch = (uint8_t)h;
+        }
+        s->branchpass = pass;
+    }
+    if (s->branch != 0xff) return far;
+    if (diagnostics.branch_oscillation) err_msg2(ERROR_BRANCH_OSCILL, NULL, epoint);
+    return true;
+}
+
 MUST_CHECK Error *instruction(int prm, unsigned int w, struct values_s *vals, argcount_t argc, linepos_t epoint) {
     Adrgen adrgen;
     Opr_types opr;
@@ -488,6 +528,7 @@ retry:
                 s = new_star(vline); stree_old = star_tree;
                 if (s->pass != 0 && s->addr != star) {
                     if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+                    if (pass_tracing) pass_trace_address(NULL, epoint, "address", s->addr, star);
                     fixeddig = false;
                 }
                 s->addr = star;
@@ -585,10 +626,10 @@ retry:
             goto noregister;
         }
         if (is_amode(amode, ADR_REL)) {
-            struct star_s *s;
+            struct star_s *s, *bs;
             uint16_t xadr;
             uval_t oadr;
-            bool crossbank, invalid;
+            bool crossbank, invalid, jump, far;
             Obj *oval;
             ln = 1; opr = OPR_REL;
             longbranch = 0;
@@ -614,6 +655,7 @@ retry:
 
             oadr = uval;
             oval = val->obj == ADDRESS_OBJ ? Address(val)->val : val;
+            jump = !invalid;
             if (oval->obj == CODE_OBJ && pass != Code(oval)->apass && !is_amode(amode, ADR_REL_L)) { /* not for 65CE02! */
                 s = new_star(vline + 1);
                 adr = s->pass != 0 ? (uint16_t)(uval - s->addr) : (uint16_t)(uval - current_address->l_address - 1 - ln);
@@ -640,8 +682,14 @@ retry:
                 uval |= current_address->l_address & ~(uval_t)0xffff;
                 oadr = uval;
                 oval = val;
+                jump = false;
             }
-            if ((adr<0xFF80 && adr>0x007F) || crossbank || w == 1 || w == 2) {
+            far = (adr<0xFF80 && adr>0x007F) || crossbank || w == 1 || w == 2;
+            if (jump && w == 3 && (arguments.longbranch || is_amode(amode, ADR_REL_L) || is_amode(amode, ADR_ADDR))) {
+                bs = (s != NULL) ? s : new_star(vline + 1);
+                far = branch_far(bs, far, epoint2);
+            } else bs = NULL;
+            if (far) {
                 if (is_amode(amode, ADR_REL_L) && !crossbank && (w == 3 || w == 1)) { /* 65CE02 long branches */
                     opr = OPR_REL_L;
                     ln = 2;
@@ -761,10 +809,11 @@ retry:
                                 address_t st = current_address->l_address;
                                 if (s->pass != 0 && s->addr != st) {
                                     if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+                                    if (pass_tracing) pass_trace_address(NULL, epoint, "address", s->addr, st);
                                     fixeddig = false;
                                 }
                                 s->addr = st;
-                            }
+                            } else if (bs != NULL) bs->addr = current_address->l_address;
                             return err;
                         }
                     }
@@ -829,10 +878,11 @@ retry:
                 address_t st = (current_address->l_address + 1 + ln) & all_mem;
                 if (s != NULL && s->pass != 0 && s->addr != st) {
                     if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+                    if (pass_tracing) pass_trace_address(NULL, epoint, "address", s->addr, st);
                     fixeddig = false;
                 }
                 s->addr = st;
-            }
+            } else if (bs != NULL) bs->addr = (current_address->l_address + 1 + ln) & all_mem;
             if (opr == OPR_BIT_ZP_REL) adr = xadr | (adr << 8);
             adrgen = AG_NONE; break;
         }
@@ -895,6 +945,7 @@ retry:
                     s = new_star(vline); stree_old = star_tree;
                     if (s->pass != 0 && s->addr != star) {
                         if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, epoint);
+                        if (pass_tracing) pass_trace_address(NULL, epoint, "address", s->addr, star);
                         fixeddig = false;
                     }
                     s->addr = star;
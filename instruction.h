@@ -28,6 +28,7 @@ struct Funcargs;
 struct values_s;
 
 extern MUST_CHECK struct Error *instruction(int, unsigned int, struct values_s *, argcount_t, linepos_t);
+extern void init_instruction(void);
 extern void select_opcodes(const struct cpu_s *);
 extern int lookup_opcode(const uint8_t *);
 extern MUST_CHECK bool touval(struct Obj *, uval_t *, unsigned int, linepos_t);
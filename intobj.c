@@ -24,6 +24,7 @@
 #include "eval.h"
 #include "variables.h"
 #include "arguments.h"
+#include "macro.h"
 
 #include "boolobj.h"
 #include "floatobj.h"
@@ -46,11 +47,16 @@
 static Type obj;
 
 static Int minus1_val = { { &obj, 1 }, -1, {1, 0}, minus1_val.val };
-static Int zero_val = { { &obj, 1 }, 0, {0, 0}, zero_val.val };
-static Int one_val = { { &obj, 1 }, 1, {1, 0}, one_val.val };
+
+/* Preallocated 0-255, results in this range are shared instead of allocated */
+#define SMALL1(n) { { &obj, 1 }, (n) != 0, {(n), 0}, small_val[n].val }
+#define SMALL4(n) SMALL1(n), SMALL1((n) + 1), SMALL1((n) + 2), SMALL1((n) + 3)
+#define SMALL16(n) SMALL4(n), SMALL4((n) + 4), SMALL4((n) + 8), SMALL4((n) + 12)
+#define SMALL64(n) SMALL16(n), SMALL16((n) + 16), SMALL16((n) + 32), SMALL16((n) + 48)
+static Int small_val[256] = { SMALL64(0), SMALL64(64), SMALL64(128), SMALL64(192) };
 
 Type *const INT_OBJ = &obj;
-Obj *const int_value[2] = { &zero_val.v, &one_val.v };
+Obj *const int_value[2] = { &small_val[0].v, &small_val[1].v };
 Obj *const minus1_value = &minus1_val.v;
 
 static inline Int *ref_int(Int *v1) {
@@ -153,7 +159,9 @@ static FAST_CALL MUST_CHECK Obj *normalize(Int *v, size_t sz, bool neg) {
 
 static MUST_CHECK Obj *return_int(digit_t c, bool neg) {
     Int *vv;
-    if (c < lenof(int_value) && (!neg || c == 0)) return val_reference(int_value[c]);
+    if (!neg || c == 0) {
+        if (c < lenof(small_val)) return val_reference(&small_val[c].v);
+    } else if (c == 1) return val_reference(minus1_value);
     vv = new_int();
     vv->data = vv->val;
     vv->val[0] = c;
@@ -171,6 +179,412 @@ static MUST_CHECK Obj *return_int_inplace(Int *vv, digit_t c, bool neg) {
     return val_reference(Obj(vv));
 }
 
+/* Operands of at least this many digits use the subquadratic algorithms */
+#define KARATSUBA_CUTOFF 40
+#define DIVISION_CUTOFF 60
+#define CONVERSION_CUTOFF 60
+
+static digit_t dadd(digit_t *v, const digit_t *v1, size_t len1, const digit_t *v2, size_t len2) {
+    size_t i;
+    twodigits_t c = 0;
+    for (i = 0; i < len2; i++) {
+        c += (twodigits_t)v1[i] + v2[i];
+        v[i] = (digit_t)c;
+        c >>= SHIFT;
+    }
+    for (; c != 0 && i < len1; i++) {
+        c += v1[i];
+        v[i] = (digit_t)c;
+        c >>= SHIFT;
+    }
+    if (v != v1 && i < len1) memcpy(v + i, v1 + i, (len1 - i) * sizeof *v);
+    return (digit_t)c;
+}
+
+static digit_t dsub(digit_t *v, const digit_t *v1, size_t len1, const digit_t *v2, size_t len2) {
+    size_t i;
+    digit_t c = 0;
+    for (i = 0; i < len2; i++) {
+        twodigits_t t = (twodigits_t)v1[i] - v2[i] - c;
+        v[i] = (digit_t)t;
+        c = (digit_t)(t >> SHIFT) & 1;
+    }
+    for (; c != 0 && i < len1; i++) {
+        c = (v1[i] == 0) ? 1 : 0;
+        v[i] = v1[i] - 1;
+    }
+    if (v != v1 && i < len1) memcpy(v + i, v1 + i, (len1 - i) * sizeof *v);
+    return c;
+}
+
+static int dcmp(const digit_t *v1, const digit_t *v2, size_t len) {
+    while (len != 0) {
+        len--;
+        if (v1[len] != v2[len]) return (v1[len] > v2[len]) ? 1 : -1;
+    }
+    return 0;
+}
+
+static void mul_base(digit_t *v, const digit_t *v1, size_t len1, const digit_t *v2, size_t len2) {
+    size_t i, j;
+    memset(v, 0, (len1 + len2) * sizeof *v);
+    for (i = 0; i < len1; i++) {
+        twodigits_t c = 0, t = v1[i];
+        digit_t *o = v + i;
+        for (j = 0; j < len2; j++) {
+            c += o[j] + v2[j] * t;
+            o[j] = (digit_t)c;
+            c >>= SHIFT;
+        }
+        if (c != 0) o[j] += (digit_t)c;
+    }
+}
+
+/* Karatsuba multiplication, v has len1 + len2 digits */
+static void kmul(digit_t *v, const digit_t *v1, size_t len1, const digit_t *v2, size_t len2) {
+    size_t h, i, l;
+    digit_t *t;
+    if (len1 < len2) {
+        const digit_t *tmp = v1; v1 = v2; v2 = tmp;
+        i = len1; len1 = len2; len2 = i;
+    }
+    if (len2 < KARATSUBA_CUTOFF) {
+        mul_base(v, v1, len1, v2, len2);
+        return;
+    }
+    h = (len1 + 1) / 2;
+    if (len2 <= h) {
+        new_array(&t, 2 * len2);
+        memset(v, 0, (len1 + len2) * sizeof *v);
+        for (i = 0; i < len1; i += len2) {
+            l = len1 - i;
+            if (l > len2) l = len2;
+            kmul(t, v1 + i, l, v2, len2);
+            dadd(v + i, v + i, l + len2, t, l + len2);
+        }
+        free(t);
+        return;
+    }
+    l = 2 * h + 2;
+    new_array(&t, 2 * l);
+    t[h] = dadd(t, v1, h, v1 + h, len1 - h);
+    t[l - 1] = dadd(t + h + 1, v2, h, v2 + h, len2 - h);
+    kmul(t + l, t, h + 1, t + h + 1, h + 1);
+    kmul(v, v1, h, v2, h);
+    kmul(v + 2 * h, v1 + h, len1 - h, v2 + h, len2 - h);
+    dsub(t + l, t + l, l, v, 2 * h);
+    dsub(t + l, t + l, l, v + 2 * h, len1 + len2 - 2 * h);
+    i = len1 + len2 - h;
+    dadd(v + h, v + h, i, t + l, (l < i) ? l : i);
+    free(t);
+}
+
+/* Long division of v0[0..k + len2) by the normalized w0, quotient into a[0..k), remainder into v0[0..len2) */
+static void div_base(digit_t *a, digit_t *v0, size_t k, const digit_t *w0, size_t len2) {
+    size_t i;
+    digit_t *vk, *ak;
+    digit_t wm1 = w0[len2 - 1], wm2 = w0[len2 - 2];
+    for (vk = v0 + k, ak = a + k; vk-- > v0;) {
+        bool c = false;
+        digit_t vtop = vk[len2];
+        twodigits_t vvv = ((twodigits_t)vtop << SHIFT) | vk[len2 - 1];
+        twodigits_t qq = vvv / wm1;
+        twodigits_t r = vvv - qq * wm1;
+        twodigits_t e;
+        digit_t q;
+        while (qq > MASK || qq * wm2 > ((r << SHIFT) | vk[len2 - 2])) {
+            --qq;
+            r += wm1;
+            if (r > MASK) break;
+        }
+        q = (digit_t)qq;
+        for (e = i = 0; i < len2; i++) {
+            digit_t t;
+            e += (twodigits_t)q * w0[i];
+            t = (digit_t)e; e >>= SHIFT;
+            if (c) {
+                c = (vk[i] <= t);
+                vk[i] = vk[i] - t - 1;
+                continue;
+            }
+            c = vk[i] < t;
+            vk[i] -= t;
+        }
+        if (c ? (vtop <= e) : (vtop < e)) {
+            c = false;
+            for (i = 0; i < len2; i++) {
+                digit_t t = vk[i];
+                if (c) {
+                    c = ((vk[i] = t + w0[i] + 1) <= t);
+                    continue;
+                }
+                c = ((vk[i] = t + w0[i]) < t);
+            }
+            --q;
+        }
+        *--ak = q;
+    }
+}
+
+static void div3n2n(digit_t *, digit_t *, const digit_t *, size_t);
+
+/* Burnikel-Ziegler division of v[0..2n) by the normalized w[0..n), requires v[n..2n) < w.
+ * Quotient into q[0..n), remainder into v[0..n) while v[n..2n) is cleared. */
+static void div2n1n(digit_t *q, digit_t *v, const digit_t *w, size_t n) {
+    if ((n & 1) != 0 || n < DIVISION_CUTOFF) {
+        div_base(q, v, n, w, n);
+        memset(v + n, 0, n * sizeof *v);
+        return;
+    }
+    n /= 2;
+    div3n2n(q + n, v + n, w, n);
+    div3n2n(q, v, w, n);
+}
+
+/* Same for v[0..3h) by w[0..2h), requires v[h..3h) < w */
+static void div3n2n(digit_t *q, digit_t *v, const digit_t *w, size_t h) {
+    size_t i;
+    digit_t *d;
+    if (dcmp(v + 2 * h, w + h, h) == 0) {
+        for (i = 0; i < h; i++) q[i] = MASK;
+        v[2 * h] = dadd(v + h, v + h, h, w + h, h);
+        memset(v + 2 * h + 1, 0, (h - 1) * sizeof *v);
+    } else div2n1n(q, v + h, w + h, h);
+    new_array(&d, 2 * h);
+    kmul(d, q, h, w, h);
+    while (v[2 * h] == 0 && dcmp(v, d, 2 * h) < 0) {
+        for (i = 0; i < h; i++) {
+            if ((q[i]--) != 0) break;
+        }
+        v[2 * h] += dadd(v, v, 2 * h, w, 2 * h);
+    }
+    v[2 * h] -= dsub(v, v, 2 * h, d, 2 * h);
+    free(d);
+}
+
+/* Division of v0[0..len1) by the normalized w0 in blocks, returns the
+ * quotient of *k digits and leaves the remainder in v0[0..len2) */
+static digit_t *div_large(digit_t *v0, size_t len1, const digit_t *w0, size_t len2, size_t *k) {
+    size_t i, n, s, t, m = len2;
+    unsigned int j = 0;
+    digit_t *w, *v, *a;
+    while (m >= DIVISION_CUTOFF) {
+        m = (m + 1) / 2;
+        j++;
+    }
+    n = m << j;
+    s = n - len2;
+    t = (len1 + s + n - 1) / n;
+    new_array(&w, n);
+    memset(w, 0, s * sizeof *w);
+    memcpy(w + s, w0, len2 * sizeof *w);
+    new_array(&v, (t + 1) * n);
+    memset(v, 0, s * sizeof *v);
+    memcpy(v + s, v0, len1 * sizeof *v);
+    memset(v + s + len1, 0, ((t + 1) * n - s - len1) * sizeof *v);
+    new_array(&a, t * n);
+    for (i = t; (i--) != 0;) div2n1n(a + i * n, v + i * n, w, n);
+    memcpy(v0, v + s, len2 * sizeof *v0);
+    free(v);
+    free(w);
+    *k = t * n;
+    return a;
+}
+
+/* Quotient of v1 / v2 into q[0..len1 - len2 + 1), remainder into r[0..len2), requires len1 >= len2 >= 2 */
+static void udivrem(digit_t *q, digit_t *r, const digit_t *v1, size_t len1, const digit_t *v2, size_t len2) {
+    size_t i, k, qlen = len1 - len2 + 1;
+    unsigned int d;
+    digit_t *v0, *w0, *a;
+    Int tmp1, tmp2, tmp3;
+
+    if (len1 + 1 < 1) err_msg_out_of_memory(); /* overflow */
+    v0 = inew(&tmp1, len1 + 1);
+    w0 = inew(&tmp2, len2);
+
+    d = 0;
+    while ((v2[len2 - 1] << d) <= MASK / 2) d++;
+
+    if (d != 0) {
+        w0[0] = v2[0] << d;
+        for (i = 1; i < len2; i++) w0[i] = (v2[i] << d) | (v2[i - 1] >> (SHIFT - d));
+        v0[0] = v1[0] << d;
+        for (i = 1; i < len1; i++) v0[i] = (v1[i] << d) | (v1[i - 1] >> (SHIFT - d));
+        v0[i] = v1[i - 1] >> (SHIFT - d);
+    } else {
+        memcpy(w0, v2, len2 * sizeof *w0);
+        v0[len1] = 0;
+        memcpy(v0, v1, len1 * sizeof *v0);
+    }
+    if (len2 >= DIVISION_CUTOFF && len1 - len2 >= DIVISION_CUTOFF) {
+        a = div_large(v0, len1 + 1, w0, len2, &k);
+    } else {
+        if (v0[len1] != 0 || v0[len1 - 1] >= w0[len2 - 1]) len1++;
+        k = len1 - len2;
+        a = inew(&tmp3, k);
+        div_base(a, v0, k, w0, len2);
+    }
+    if (w0 != tmp2.val) free(w0);
+
+    if (k > qlen) k = qlen;
+    memcpy(q, a, k * sizeof *q);
+    memset(q + k, 0, (qlen - k) * sizeof *q);
+    if (a != tmp3.val) free(a);
+
+    if (d != 0) {
+        for (i = 0; i < len2 - 1; i++) r[i] = (v0[i] >> d) | (v0[i + 1] << (SHIFT - d));
+        r[i] = v0[i] >> d;
+    } else memcpy(r, v0, len2 * sizeof *r);
+    if (v0 != tmp1.val) free(v0);
+}
+
+/* Powers of 10^(9 * 2^i) for the radix conversions */
+struct dpow_s {
+    digit_t *data;
+    size_t len;
+};
+
+static void dpow_next(struct dpow_s *p, size_t i) {
+    size_t l;
+    if (i == 0) {
+        new_array(&p[0].data, 1);
+        p[0].data[0] = DMUL;
+        p[0].len = 1;
+        return;
+    }
+    l = 2 * p[i - 1].len;
+    new_array(&p[i].data, l);
+    kmul(p[i].data, p[i - 1].data, p[i - 1].len, p[i - 1].data, p[i - 1].len);
+    while (p[i].data[l - 1] == 0) l--;
+    p[i].len = l;
+}
+
+static void dpow_free(struct dpow_s *p, size_t n) {
+    while (n != 0) free(p[--n].data);
+}
+
+/* Base 10^9 digits of v[0..len) into out, returns their count */
+static size_t dec_base(digit_t *out, const digit_t *v, size_t len) {
+    size_t i, j, sz;
+    for (sz = 0, i = len; (i--) != 0;) {
+        digit_t h = v[i];
+        for (j = 0; j < sz; j++) {
+            twodigits_t tm = ((twodigits_t)out[j] << SHIFT) | h;
+            h = (digit_t)(tm / DMUL);
+            out[j] = (digit_t)(tm - (twodigits_t)h * DMUL);
+        }
+        while (h != 0) {
+            out[sz++] = h % DMUL;
+            h /= DMUL;
+        }
+    }
+    return sz;
+}
+
+/* Base 10^9 digits of v[0..len) into out[0..2^k), requires v < p[k] */
+static void to_dec(digit_t *out, const digit_t *v, size_t len, const struct dpow_s *p, size_t k) {
+    size_t h, ql;
+    digit_t *q, *r;
+    while (len != 0 && v[len - 1] == 0) len--;
+    if (len < CONVERSION_CUTOFF) {
+        h = dec_base(out, v, len);
+        memset(out + h, 0, (((size_t)1 << k) - h) * sizeof *out);
+        return;
+    }
+    k--;
+    h = (size_t)1 << k;
+    if (len < p[k].len) {
+        to_dec(out, v, len, p, k);
+        memset(out + h, 0, h * sizeof *out);
+        return;
+    }
+    ql = len - p[k].len + 1;
+    new_array(&q, ql);
+    new_array(&r, p[k].len);
+    udivrem(q, r, v, len, p[k].data, p[k].len);
+    to_dec(out, r, p[k].len, p, k);
+    free(r);
+    to_dec(out + h, q, ql, p, k);
+    free(q);
+}
+
+/* Binary value of base 10^9 digits d[0..len) into v[0..len), returns the length, requires len <= 2^k */
+static size_t from_dec(digit_t *v, const digit_t *d, size_t len, const struct dpow_s *p, size_t k) {
+    size_t h, l1, l2;
+    digit_t *t;
+    if (len < CONVERSION_CUTOFF) {
+        size_t i, j;
+        for (l1 = 0, i = len; (i--) != 0;) {
+            twodigits_t c = d[i];
+            for (j = 0; j < l1; j++) {
+                c += (twodigits_t)v[j] * DMUL;
+                v[j] = (digit_t)c;
+                c >>= SHIFT;
+            }
+            if (c != 0) v[l1++] = (digit_t)c;
+        }
+        return l1;
+    }
+    k--;
+    h = (size_t)1 << k;
+    if (len <= h) return from_dec(v, d, len, p, k);
+    new_array(&t, len);
+    l1 = from_dec(t, d + h, len - h, p, k);
+    l2 = from_dec(t + len - h, d, h, p, k);
+    kmul(v, t, l1, p[k].data, p[k].len);
+    l1 += p[k].len;
+    dadd(v, v, l1, t + len - h, l2);
+    free(t);
+    while (l1 != 0 && v[l1 - 1] == 0) l1--;
+    return l1;
+}
+
+static inline bool small_int(const Int *v1) {
+    return v1->len >= -1 && v1->len <= 1;
+}
+
+static inline twodigits_t small_digit(const Int *v1) {
+    return (v1->len != 0) ? v1->data[0] : 0;
+}
+
+static inline twodigits_t small_value(const Int *v1) {
+    return (v1->len < 0) ? -small_digit(v1) : small_digit(v1);
+}
+
+static MUST_CHECK Obj *return_int2(oper_t op, twodigits_t c, bool neg) {
+    Int *v = Int(op->v1);
+    if (c < lenof(small_val) || op->inplace != Obj(v) || v->data != v->val) {
+        if (c <= (twodigits_t)MASK) return return_int((digit_t)c, neg);
+        v = new_int();
+        v->data = v->val;
+    } else ref_int(v);
+    v->val[0] = (digit_t)c;
+    if (c > (twodigits_t)MASK) {
+        v->val[1] = (digit_t)(c >> SHIFT);
+        v->len = neg ? -2 : 2;
+    } else v->len = neg ? -1 : 1;
+    return Obj(v);
+}
+
+static MUST_CHECK Obj *return_int_twos(oper_t op, twodigits_t c) {
+    bool neg = (c >> (2 * SHIFT - 1)) != 0;
+    return return_int2(op, neg ? -c : c, neg);
+}
+
+static MUST_CHECK Obj *calc2_small(oper_t op) {
+    const Int *v1 = Int(op->v1), *v2 = Int(op->v2);
+    switch (op->op) {
+    case O_ADD: return return_int_twos(op, small_value(v1) + small_value(v2));
+    case O_SUB: return return_int_twos(op, small_value(v1) - small_value(v2));
+    case O_MUL: return return_int2(op, small_digit(v1) * small_digit(v2), (v1->len ^ v2->len) < 0);
+    case O_AND: return return_int_twos(op, small_value(v1) & small_value(v2));
+    case O_OR: return return_int_twos(op, small_value(v1) | small_value(v2));
+    case O_XOR: return return_int_twos(op, small_value(v1) ^ small_value(v2));
+    default: break;
+    }
+    return NULL;
+}
+
 static void iadd(const Int *, const Int *, Int *);
 static void isub(const Int *, const Int *, Int *);
 
@@ -267,21 +681,22 @@ static MUST_CHECK Obj *repr(Obj *o1, linepos_t UNUSED(epoint), size_t maxsize) {
     sz = len * SHIFT / (3 * DSHIFT);
     if (len > SSIZE_MAX / SHIFT) return NULL; /* overflow */
     if (sz * DSHIFT > maxsize) return NULL;
-    sz++;
-    out = inew2(&tmp, sz);
-    if (out == NULL) return NULL;
-
-    for (sz = 0, i = len; (i--) != 0;) {
-        digit_t h = v1->data[i];
-        for (j = 0; j < sz; j++) {
-            twodigits_t tm = ((twodigits_t)out[j] << SHIFT) | h;
-            h = (digit_t)(tm / DMUL);
-            out[j] = (digit_t)(tm - (twodigits_t)h * DMUL);
-        }
-        while (h != 0) {
-            out[sz++] = h % DMUL;
-            h /= DMUL;
-        }
+    if (len < CONVERSION_CUTOFF) {
+        out = inew2(&tmp, sz + 1);
+        if (out == NULL) return NULL;
+        sz = dec_base(out, v1->data, len);
+    } else {
+        struct dpow_s p[8 * sizeof(size_t)];
+        i = 0;
+        do {
+            dpow_next(p, i);
+        } while (p[i++].len <= len);
+        sz = (size_t)1 << (i - 1);
+        out = inew2(&tmp, sz);
+        if (out != NULL) to_dec(out, v1->data, len, p, i - 1);
+        dpow_free(p, i);
+        if (out == NULL) return NULL;
+        while (sz != 0 && out[sz - 1] == 0) sz--;
     }
     if (sz == 0) out[sz] = 0;
     else sz--;
@@ -568,8 +983,8 @@ static void isub(const Int *vv1, const Int *vv2, Int *vv) {
 }
 
 static void imul(const Int *vv1, const Int *vv2, Int *vv) {
-    size_t i, j, len1, len2, sz;
-    digit_t *v1, *v2, *v;
+    size_t i, len1, len2, sz;
+    digit_t *v;
     Int tmp;
     len1 = intlen(vv1);
     len2 = intlen(vv2);
@@ -589,18 +1004,7 @@ static void imul(const Int *vv1, const Int *vv2, Int *vv) {
         return;
     }
     v = inew(&tmp, sz);
-    memset(v, 0, sz * sizeof *v);
-    v1 = vv1->data; v2 = vv2->data;
-    for (i = 0; i < len1; i++) {
-        twodigits_t c = 0, t = v1[i];
-        digit_t *o = v + i;
-        for (j = 0; j < len2; j++) {
-            c += o[j] + v2[j] * t;
-            o[j] = (digit_t)c;
-            c >>= SHIFT;
-        }
-        if (c != 0) o[j] += (digit_t)c;
-    }
+    kmul(v, vv1->data, len1, vv2->data, len2);
     i = sz;
     while (i != 0 && v[i - 1] == 0) i--;
     if (vv == vv1 || vv == vv2) destroy(Obj(vv));
@@ -671,105 +1075,32 @@ static MUST_CHECK Obj *idivrem(oper_t op, bool divrem) {
         }
         return op->inplace == Obj(vv1) ? return_int_inplace(vv1, (digit_t)r, negr) : return_int((digit_t)r, negr);
     } else {
-        size_t i, k;
-        unsigned int d;
-        digit_t wm1, wm2, *v0, *vk, *w0, *ak, *a;
-        Int tmp1, tmp2, tmp3;
-
-        if (len1 + 1 < 1) err_msg_out_of_memory(); /* overflow */
-        v0 = inew(&tmp1, len1 + 1);
-        w0 = inew(&tmp2, len2);
-
-        d = 0;
-        while ((v2[len2 - 1] << d) <= MASK / 2) d++;
-
-        if (d != 0) {
-            w0[0] = v2[0] << d;
-            for (i = 1; i < len2; i++) w0[i] = (v2[i] << d) | (v2[i - 1] >> (SHIFT - d));
-            v0[0] = v1[0] << d;
-            for (i = 1; i < len1; i++) v0[i] = (v1[i] << d) | (v1[i - 1] >> (SHIFT - d));
-            v0[i] = v1[i - 1] >> (SHIFT - d);
-        } else {
-            memcpy(w0, v2, len2 * sizeof *w0);
-            v0[len1] = 0;
-            memcpy(v0, v1, len1 * sizeof *v0);
-        }
-        if (v0[len1] != 0 || v0[len1 - 1] >= w0[len2 - 1]) len1++;
-
-        k = len1 - len2;
-        a = inew(&tmp3, k);
-
-        wm1 = w0[len2 - 1]; wm2 = w0[len2 - 2];
-        for (vk = v0 + k, ak = a + k; vk-- > v0;) {
-            bool c = false;
-            digit_t vtop = vk[len2];
-            twodigits_t vvv = ((twodigits_t)vtop << SHIFT) | vk[len2 - 1];
-            digit_t q = (digit_t)(vvv / wm1);
-            digit_t r = (digit_t)(vvv - (twodigits_t)q * wm1);
-            twodigits_t e;
-            while ((twodigits_t)q * wm2 > (((twodigits_t)r << SHIFT) | vk[len2 - 2])) {
-                --q;
-                r += wm1;
-                if (r < wm1) break;
-            }
-            for (e = i = 0; i < len2; i++) {
-                digit_t t;
-                e += (twodigits_t)q * w0[i];
-                t = (digit_t)e; e >>= SHIFT;
-                if (c) {
-                    c = (vk[i] <= t);
-                    vk[i] = vk[i] - t - 1;
-                    continue;
-                }
-                c = vk[i] < t;
-                vk[i] -= t;
-            }
-            if (c ? (vtop <= e) : (vtop < e)) {
-                c = false;
-                for (i = 0; i < len2; i++) {
-                    digit_t t = vk[i];
-                    if (c) {
-                        c = ((vk[i] = t + w0[i] + 1) <= t);
-                        continue;
-                    }
-                    c = ((vk[i] = t + w0[i]) < t);
-                }
-                --q;
-            }
-            *--ak = q;
-        }
-        if (w0 != tmp2.val) free(w0);
+        size_t i, k = len1 - len2 + 1;
+        digit_t *r;
+        Int tmp;
 
         vv = new_int();
         if (divrem) {
+            vv->data = v = inew(vv, k + 1);
+            r = inew(&tmp, len2);
+            udivrem(v, r, v1, len1, v2, len2);
+            v[k] = 0;
             if (neg) {
-                while (len2 != 0 && v0[len2 - 1] == 0) len2--;
+                while (len2 != 0 && r[len2 - 1] == 0) len2--;
                 if (len2 != 0) {
                     for (i = 0; i < k; i++) {
-                        if ((a[i] = a[i] + 1) >= 1) break;
+                        if ((v[i] = v[i] + 1) >= 1) break;
                     }
+                    if (i == k) v[k] = 1;
                 }
             }
-            if (v0 != tmp1.val) free(v0);
-            if (a == tmp3.val) {
-                memcpy(&vv->val, a, k * sizeof *a);
-                a = vv->val;
-            }
-            vv->data = a;
-            return normalize(vv, k, neg);
-        }
-
-        if (d != 0) {
-            for (i = 0; i < len2 - 1; i++) v0[i] = (v0[i] >> d) | (v0[i + 1] << (SHIFT - d));
-            v0[i] >>= d;
+            if (r != tmp.val) free(r);
+            return normalize(vv, k + 1, neg);
         }
-
-        if (a != tmp3.val) free(a);
-        if (v0 == tmp1.val) {
-            memcpy(&vv->val, v0, len2 * sizeof *v0);
-            v0 = vv->val;
-        }
-        vv->data = v0;
+        vv->data = v = inew(vv, len2);
+        r = inew(&tmp, k);
+        udivrem(r, v, v1, len1, v2, len2);
+        if (r != tmp.val) free(r);
         return normalize(vv, len2, negr);
     }
 }
@@ -953,15 +1284,6 @@ static inline MUST_CHECK Obj *and_(oper_t op) {
     len1 = intlen(vv1);
     len2 = intlen(vv2);
 
-    if (len1 <= 1 && len2 <= 1) {
-        digit_t c;
-        neg1 = (vv1->len < 0); neg2 = (vv2->len < 0);
-        c = neg1 ? -vv1->val[0] : vv1->val[0];
-        c &= neg2 ? -vv2->val[0] : vv2->val[0];
-        if (!neg2) neg1 = false;
-        if (neg1) c = -c;
-        return op->inplace == Obj(vv1) ? return_int_inplace(vv1, c, neg1) : return_int(c, neg1);
-    }
     if (len1 < len2) {
         Int *tmp = vv1; vv1 = vv2; vv2 = tmp;
         i = len1; len1 = len2; len2 = i;
@@ -1064,15 +1386,6 @@ static inline MUST_CHECK Obj *or_(oper_t op) {
     len1 = intlen(vv1);
     len2 = intlen(vv2);
 
-    if (len1 <= 1 && len2 <= 1) {
-        digit_t c;
-        neg1 = (vv1->len < 0); neg2 = (vv2->len < 0);
-        c = neg1 ? -vv1->val[0] : vv1->val[0];
-        c |= neg2 ? -vv2->val[0] : vv2->val[0];
-        if (neg2) neg1 = true;
-        if (neg1) c = -c;
-        return op->inplace == Obj(vv1) ? return_int_inplace(vv1, c, neg1) : return_int(c, neg1);
-    }
     if (len1 < len2) {
         Int *tmp = vv1; vv1 = vv2; vv2 = tmp;
         i = len1; len1 = len2; len2 = i;
@@ -1178,15 +1491,6 @@ static inline MUST_CHECK Obj *xor_(oper_t op) {
     len1 = intlen(vv1);
     len2 = intlen(vv2);
 
-    if (len1 <= 1 && len2 <= 1) {
-        digit_t c;
-        neg1 = (vv1->len < 0); neg2 = (vv2->len < 0);
-        c = neg1 ? -vv1->val[0] : vv1->val[0];
-        c ^= neg2 ? -vv2->val[0] : vv2->val[0];
-        if (neg2) neg1 = !neg1;
-        if (neg1) c = -c;
-        return op->inplace == Obj(vv1) ? return_int_inplace(vv1, c, neg1) : return_int(c, neg1);
-    }
     if (len1 < len2) {
         Int *tmp = vv1; vv1 = vv2; vv2 = tmp;
         i = len1; len1 = len2; len2 = i;
@@ -1313,7 +1617,7 @@ static ssize_t icmp(oper_t op) {
 MUST_CHECK Obj *int_from_size(size_t i) {
     unsigned int j;
     Int *v;
-    if (i < lenof(int_value)) return val_reference(int_value[i]);
+    if (i < lenof(small_val)) return val_reference(&small_val[i].v);
     v = new_int();
     v->data = v->val;
     v->val[0] = (digit_t)i;
@@ -1332,18 +1636,7 @@ MUST_CHECK Obj *int_from_uval(uval_t i) {
 }
 
 MUST_CHECK Obj *int_from_ival(ival_t i) {
-    Int *v;
-    if (i == 0) return val_reference(int_value[0]);
-    v = new_int();
-    v->data = v->val;
-    if (i > 0) {
-        v->val[0] = (uval_t)i;
-        v->len = 1;
-    } else {
-        v->val[0] = -(uval_t)i;
-        v->len = -1;
-    }
-    return Obj(v);
+    return (i < 0) ? return_int(-(uval_t)i, true) : return_int((uval_t)i, false);
 }
 
 MUST_CHECK Obj *int_from_float(const Float *v1, linepos_t epoint) {
@@ -1488,6 +1781,7 @@ MUST_CHECK Obj *int_from_str(Str *v1, linepos_t epoint) {
     size_t i, j, sz, osz;
     digit_t *d;
 
+    function_impure(PURITY_NONE); /* encoding dependent */
     if (actual_encoding->updating) {
         if (v1->chars == 1) {
             unichar_t ch2 = v1->data[0];
@@ -1593,14 +1887,39 @@ MUST_CHECK Obj *int_from_decstr(const uint8_t *s, linecpos_t *ln, linecpos_t *ln
     i = k - i;
     *ln2 = i;
     if (val <= ((~(digit_t)0)-9)/10) {
-        if (val >= lenof(int_value)) {
-            v = new_int();
-            v->data = v->val;
-            v->val[0] = val;
-            v->len = 1;
-            return Obj(v);
+        return return_int(val, false);
+    }
+    if (i >= DSHIFT * CONVERSION_CUTOFF) {
+        struct dpow_s p[8 * sizeof(size_t)];
+        digit_t *dd;
+        size_t j;
+        sz = (i + DSHIFT - 1) / DSHIFT;
+        dd = allocate_array(digit_t, sz);
+        if (dd == NULL) return NULL;
+        end = s + k;
+        for (j = 0; j < sz; j++) {
+            digit_t mul;
+            val = 0;
+            for (mul = 1; mul < DMUL && end > s;) {
+                uint8_t c = *--end ^ 0x30;
+                if (c < 10) {
+                    val += c * mul;
+                    mul *= 10;
+                }
+            }
+            dd[j] = val;
+        }
+        v = new_int();
+        v->data = d = inew2(v, sz);
+        if (d == NULL) {
+            free(dd);
+            goto failed2;
         }
-        return val_reference(int_value[val]);
+        for (j = 0; ((size_t)1 << j) < sz; j++) dpow_next(p, j);
+        sz = from_dec(d, dd, sz, p, j);
+        dpow_free(p, j);
+        free(dd);
+        return normalize(v, sz, false);
     }
     sz = (size_t)((double)i * 0.11073093649624542178511177326072356663644313812255859375) + 1;
 
@@ -1660,6 +1979,10 @@ static MUST_CHECK Obj *calc2_int(oper_t op) {
     Obj *val;
     ival_t shift;
     ssize_t cmp;
+    if (small_int(v1) && small_int(v2)) {
+        val = calc2_small(op);
+        if (val != NULL) return val;
+    }
     switch (op->op) {
     case O_CMP:
         cmp = icmp(op);
@@ -1853,8 +2176,10 @@ void intobj_names(void) {
 
 void intobj_destroy(void) {
 #ifdef DEBUG
-    if (int_value[0]->refcount != 1) fprintf(stderr, "int[0] %" PRIuSIZE "\n", int_value[0]->refcount - 1);
-    if (int_value[1]->refcount != 1) fprintf(stderr, "int[1] %" PRIuSIZE "\n", int_value[1]->refcount - 1);
+    size_t i;
+    for (i = 0; i < lenof(small_val); i++) {
+        if (small_val[i].v.refcount != 1) fprintf(stderr, "int[%" PRIuSIZE "] %" PRIuSIZE "\n", i, small_val[i].v.refcount - 1);
+    }
     if (minus1_value->refcount != 1) fprintf(stderr, "int[-1] %" PRIuSIZE "\n", minus1_value->refcount - 1);
 #endif
 }
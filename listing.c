@@ -32,6 +32,7 @@
 #include "values.h"
 #include "arguments.h"
 #include "macro.h"
+#include "profile.h"
 #include "version.h"
 
 #define LINE_WIDTH 8
@@ -44,6 +45,44 @@ bool listing_pccolumn;
 unsigned int nolisting;   /* listing */
 const uint8_t *llist = NULL;
 
+typedef enum Listing_types {
+    LISTING_EQUAL, LISTING_EQUAL2, LISTING_LINE, LISTING_LINE_CUT,
+    LISTING_LINE_CUT2, LISTING_INSTR, LISTING_MEM, LISTING_FILE
+} Listing_types;
+
+struct listing_event_s {
+    Listing_types type;
+    linecpos_t pos;
+    linenum_t line;
+    const struct file_s *file;
+    const struct cpu_s *cpu;
+    const uint8_t *llist;           /* source line if it's in the file */
+    size_t text;                    /* otherwise a copy of it in the text buffer */
+    address_t address, l_address;
+    union {
+        Obj *val;
+        const char *txt;
+        struct {
+            uint32_t adr, dpage, outputeor;
+            unsigned int cod, databank;
+            int ln;
+        } instr;
+        struct {
+            size_t data, len;
+            address_t addr, addr2;
+        } mem;
+    } u;
+};
+
+static struct {
+    struct listing_event_s *data;
+    size_t p, len;
+    uint8_t *text;
+    size_t textp, textlen;
+} events;
+
+static bool recording;
+
 typedef struct Listing {
     size_t c;
     char *s;
@@ -53,6 +92,8 @@ typedef struct Listing {
         unsigned int addr, laddr, hex, monitor, source;
     } columns;
     FILE *flist;
+    const struct listing_event_s *ev;
+    const uint8_t *llist;
     uint16_t lastfile;
     unsigned int tab_size;
     bool linenum, verbose, monitor, pccolumn, source;
@@ -103,21 +144,21 @@ static void out_long(Listing *ls, unsigned int adr) {
 }
 
 static void out_zp(Listing *ls, unsigned int adr) {
-    adr = (uint16_t)(((uint8_t)adr) + dpage);
+    adr = (uint16_t)(((uint8_t)adr) + ls->ev->u.instr.dpage);
     if (adr > 0xff) out_word(ls, adr);
     else out_byte(ls, adr);
 }
 
 static void out_db(Listing *ls, unsigned int adr) {
     *ls->s++ = '$';
-    if (databank != 0) out_hex(ls, databank);
+    if (ls->ev->u.instr.databank != 0) out_hex(ls, ls->ev->u.instr.databank);
     out_hex(ls, adr >> 8);
     out_hex(ls, adr);
 }
 
 static void out_pb(Listing *ls, unsigned int adr) {
     *ls->s++ = '$';
-    if (current_address->l_address > 0xffff) out_hex(ls, current_address->l_address >> 16);
+    if (ls->ev->l_address > 0xffff) out_hex(ls, ls->ev->l_address >> 16);
     out_hex(ls, adr >> 8);
     out_hex(ls, adr);
 }
@@ -222,15 +263,15 @@ void listing_close(const struct list_output_s *output) {
 
 static bool printllist(Listing *ls) {
     const uint8_t *c;
-    if (llist == NULL) return true;
-    c = llist;
+    if (ls->llist == NULL) return true;
+    c = ls->llist;
     while (*c == 0x20 || *c == 0x09) c++;
     if (*c != 0) {
         padding2(ls, ls->columns.source);
         flushbuf(ls);
-        printable_print(llist, ls->flist);
+        printable_print(ls->llist, ls->flist);
     }
-    llist = NULL;
+    ls->llist = NULL;
     return *c == 0;
 }
 
@@ -254,25 +295,22 @@ static void printfile(Listing *ls) {
 }
 
 static void printline(Listing *ls) {
-    uint16_t curfile = current_file_list->file->uid;
-    if (current_file_list->file->notfile) return;
-    printdec(ls, lpoint.line);
+    uint16_t curfile = ls->ev->file->uid;
+    if (ls->ev->file->notfile) return;
+    printdec(ls, ls->ev->line);
     if (ls->lastfile == curfile) return;
     ls->lastfile = curfile;
     printfile(ls);
 }
 
-FAST_CALL void listing_equal(Obj *val) {
-    Listing *const ls = listing;
-    if (ls == NULL) return;
-    if (nolisting != 0 || !ls->source || in_function) return;
+static void print_equal(Listing *ls) {
     if (ls->linenum) {
         printline(ls);
         padding2(ls, ls->columns.addr);
         flushbuf(ls);
     }
     putc('=', ls->flist);
-    ls->c += val_print(val, ls->flist, ls->verbose ? SIZE_MAX : ls->columns.source - 2) + 1;
+    ls->c += val_print(ls->ev->u.val, ls->flist, ls->verbose ? SIZE_MAX : ls->columns.source - 2) + 1;
     printllist(ls);
     newline(ls);
 }
@@ -315,19 +353,21 @@ static void printhex2(Listing *ls, unsigned int ln, const uint8_t *data) {
 }
 
 static void printmon(Listing *ls, unsigned int cod, int ln, uint32_t adr) {
+    const struct cpu_s *cpu;
     const char *mode;
     Adr_types type;
     uint32_t mnem;
 
     padding2(ls, ls->columns.monitor);
-    mnem = current_cpu->mnemonic[current_cpu->disasm[cod] & 0xff];
+    cpu = ls->ev->cpu;
+    mnem = cpu->mnemonic[cpu->disasm[cod] & 0xff];
     ls->s[0] = (char)(mnem >> 16);
     ls->s[1] = (char)(mnem >> 8);
     ls->s[2] = (char)(mnem);
     ls->s[3] = ' ';
     ls->s += 4;
 
-    type = (Adr_types)(current_cpu->disasm[cod] >> 8);
+    type = (Adr_types)(cpu->disasm[cod] >> 8);
     mode = addr_modes[type];
     if (*mode != ' ') *ls->s++ = *mode;
     mode++;
@@ -366,159 +406,121 @@ static void printmon(Listing *ls, unsigned int cod, int ln, uint32_t adr) {
     case ADR_ZP_Y: out_zp(ls, adr); break;
     case ADR_ADDR_0_I:
     case ADR_ADDR_0_LI: out_word(ls, adr); break;
-    case ADR_REL: if (ln > 0) out_pb(ls, (address_t)((int8_t)adr + (int)current_address->l_address)); else ls->s--; return;
+    case ADR_REL: if (ln > 0) out_pb(ls, (address_t)((int8_t)adr + (int)ls->ev->l_address)); else ls->s--; return;
     case ADR_BIT_ZP_REL:
         out_bit(ls, cod, adr);
         *ls->s++ = ',';
-        out_pb(ls, (address_t)((int8_t)(adr >> 8) + (int)current_address->l_address));
+        out_pb(ls, (address_t)((int8_t)(adr >> 8) + (int)ls->ev->l_address));
         return;
-    case ADR_REL_L: if (ln > 0) out_pb(ls, adr + (((cod & 0x0F) == 3) ? -1U : 0) + current_address->l_address); else ls->s--; return;
+    case ADR_REL_L: if (ln > 0) out_pb(ls, adr + (((cod & 0x0F) == 3) ? -1U : 0) + ls->ev->l_address); else ls->s--; return;
     case ADR_MOVE: out_byte(ls, adr >> 8); ls->s[0] = ','; ls->s[1] = '#'; ls->s += 2; out_byte(ls, adr); return;
     }
     while (*mode != 0) *ls->s++ = *mode++;
 }
 
 static void printsource(Listing *ls, linecpos_t pos) {
-    while (pos > 0 && (llist[pos-1] == 0x20 || llist[pos-1] == 0x09)) pos--;
+    while (pos > 0 && (ls->llist[pos-1] == 0x20 || ls->llist[pos-1] == 0x09)) pos--;
     padding2(ls, ls->columns.source);
     flushbuf(ls);
-    printable_print2(llist, ls->flist, pos);
+    printable_print2(ls->llist, ls->flist, pos);
     newline(ls);
 }
 
-FAST_CALL void listing_equal2(Obj *val, linecpos_t pos) {
-    Listing *const ls = listing;
-    if (ls == NULL) return;
-    if (nolisting != 0 || !ls->source || in_function) return;
+static void print_equal2(Listing *ls) {
     if (ls->linenum) {
         printline(ls);
         padding2(ls, ls->columns.addr);
         flushbuf(ls);
     }
     putc('=', ls->flist);
-    ls->c += val_print(val, ls->flist, ls->verbose ? SIZE_MAX : ls->columns.source - 2) + 1;
+    ls->c += val_print(ls->ev->u.val, ls->flist, ls->verbose ? SIZE_MAX : ls->columns.source - 2) + 1;
     if (ls->verbose) {
         printllist(ls);
         newline(ls);
     } else {
-        printsource(ls, pos);
+        printsource(ls, ls->ev->pos);
     }
-    llist = NULL;
 }
 
-
-FAST_CALL void listing_line(linecpos_t pos) {
-    Listing *const ls = listing;
-    size_t i;
-    if (nolisting != 0  || in_function || llist == NULL) return;
-    if (ls == NULL) {
-        address_t addr;
-        if (!fixeddig || constcreated || listing_pccolumn || !arguments.list.source) return;
-        addr = current_address->l_address;
-        i = 0;
-        while (i < pos && (llist[i] == 0x20 || llist[i] == 0x09)) i++;
-        if (i < pos && current_address->address != addr) listing_pccolumn = true;
-        return;
-    }
-    if (!ls->source) return;
-    i = 0;
-    while (i < pos && (llist[i] == 0x20 || llist[i] == 0x09)) i++;
+static void print_line(Listing *ls) {
+    const struct listing_event_s *ev = ls->ev;
+    linecpos_t pos = ev->pos;
+    size_t i = 0;
+    while (i < pos && (ls->llist[i] == 0x20 || ls->llist[i] == 0x09)) i++;
     if (i < pos) {
         if (ls->linenum) {
             printline(ls);
             padding2(ls, ls->columns.addr);
         }
         *ls->s++ = '.';
-        printaddr2(ls, current_address->address, current_address->l_address);
+        printaddr2(ls, ev->address, ev->l_address);
     }
     if (ls->verbose) {
         if (ls->s != ls->buf) flushbuf(ls);
-        if (llist[i] != 0) {
+        if (ls->llist[i] != 0) {
             if (ls->c == 0 && ls->linenum) printline(ls);
             padding2(ls, ls->columns.source);
             flushbuf(ls);
-            printable_print(llist, ls->flist);
+            printable_print(ls->llist, ls->flist);
         }
         newline(ls);
     } else {
         if (ls->c != 0 || ls->s != ls->buf) printsource(ls, pos);
     }
-    llist = NULL;
 }
 
-FAST_CALL void listing_line_cut(linecpos_t pos) {
-    Listing *const ls = listing;
-    size_t i;
-    if (nolisting != 0 || in_function || llist == NULL) return;
-    if (ls == NULL) {
-        if (!fixeddig || constcreated || listing_pccolumn || !arguments.list.source) return;
-        i = 0;
-        while (i < pos && (llist[i] == 0x20 || llist[i] == 0x09)) i++;
-        if (i < pos && current_address->address != current_address->l_address) listing_pccolumn = true;
-        return;
-    }
-    if (!ls->source) return;
-    i = 0;
-    while (i < pos && (llist[i] == 0x20 || llist[i] == 0x09)) i++;
+static void print_line_cut(Listing *ls) {
+    const struct listing_event_s *ev = ls->ev;
+    linecpos_t pos = ev->pos;
+    size_t i = 0;
+    while (i < pos && (ls->llist[i] == 0x20 || ls->llist[i] == 0x09)) i++;
     if (i < pos) {
         if (ls->linenum) {
             printline(ls);
             padding2(ls, ls->columns.addr);
         }
         *ls->s++ = '.';
-        printaddr2(ls, current_address->address, current_address->l_address);
+        printaddr2(ls, ev->address, ev->l_address);
         printsource(ls, pos);
     }
-    llist = NULL;
 }
 
-FAST_CALL void listing_line_cut2(linecpos_t pos) {
-    Listing *const ls = listing;
-    if (ls == NULL || !ls->verbose || llist == NULL) return;
-    if (nolisting == 0 && ls->source && !in_function) {
-        if (ls->linenum) printline(ls);
-        padding2(ls, ls->columns.source);
-        flushbuf(ls);
-        caret_print(llist, ls->flist, pos);
-        printable_print(llist + pos, ls->flist);
-        newline(ls);
-        llist = NULL;
-    }
+static void print_line_cut2(Listing *ls) {
+    if (ls->linenum) printline(ls);
+    padding2(ls, ls->columns.source);
+    flushbuf(ls);
+    caret_print(ls->llist, ls->flist, ls->ev->pos);
+    printable_print(ls->llist + ls->ev->pos, ls->flist);
+    newline(ls);
 }
 
-void listing_instr(unsigned int cod, uint32_t adr, int ln) {
-    Listing *const ls = listing;
+static void print_instr(Listing *ls) {
+    const struct listing_event_s *ev = ls->ev;
+    int ln = ev->u.instr.ln;
     address_t addr, addr2;
-    if (nolisting != 0 || in_function) return;
-    if (ls == NULL) {
-        if (!fixeddig || constcreated || listing_pccolumn) return;
-        ln++;
-        addr = (current_address->l_address - (unsigned int)ln) & all_mem;
-        addr2 = (current_address->address - (unsigned int)ln) & all_mem2;
-        if (addr2 != addr) listing_pccolumn = true;
-        return;
-    }
-    if (ln < 0 && !ls->source) return;
     if (ls->linenum) {
-        if (llist != NULL) printline(ls);
+        if (ls->llist != NULL) printline(ls);
         padding2(ls, ls->columns.addr);
     }
-    addr = (current_address->l_address - (unsigned int)(ln + 1)) & all_mem;
-    addr2 = (current_address->address - (unsigned int)(ln + 1)) & all_mem2;
+    addr = (ev->l_address - (unsigned int)(ln + 1)) & all_mem;
+    addr2 = (ev->address - (unsigned int)(ln + 1)) & all_mem2;
     *ls->s++ = '.';
     printaddr2(ls, addr2, addr);
     if (ln >= 0) {
-        printhex(ls, cod ^ outputeor, adr ^ outputeor, ln);
+        printhex(ls, ev->u.instr.cod ^ ev->u.instr.outputeor, ev->u.instr.adr ^ ev->u.instr.outputeor, ln);
         if (ls->monitor) {
-            printmon(ls, cod, ln, adr);
+            printmon(ls, ev->u.instr.cod, ln, ev->u.instr.adr);
         }
     }
     if (!ls->source || printllist(ls)) flushbuf(ls);
     newline(ls);
 }
 
-void listing_mem(const uint8_t *data, size_t len, address_t myaddr, address_t myaddr2) {
-    Listing *const ls = listing;
+static void print_mem(Listing *ls) {
+    const uint8_t *data = events.text + ls->ev->u.mem.data;
+    size_t len = ls->ev->u.mem.len;
+    address_t myaddr = ls->ev->u.mem.addr;
+    address_t myaddr2 = ls->ev->u.mem.addr2;
     bool print, exitnow;
     int lcol;
     unsigned int repeat;
@@ -529,11 +531,6 @@ void listing_mem(const uint8_t *data, size_t len, address_t myaddr, address_t my
     } prev, current;
     size_t p;
 
-    if (nolisting != 0 || in_function) return;
-    if (ls == NULL) {
-         if (myaddr != myaddr2) listing_pccolumn = true;
-         return;
-    }
     print = true; exitnow = false;
     prev.addr = current.addr = myaddr;
     prev.addr2 = current.addr2 = myaddr2;
@@ -596,9 +593,8 @@ void listing_mem(const uint8_t *data, size_t len, address_t myaddr, address_t my
     goto flush;
 }
 
-void listing_file(const char *txt, const struct file_s *file) {
-    Listing *const ls = listing;
-    if (ls == NULL) return;
+static void print_file(Listing *ls) {
+    const struct file_s *file = ls->ev->file;
     newline(ls);
     if (ls->linenum) {
         if (file != NULL) {
@@ -611,8 +607,192 @@ void listing_file(const char *txt, const struct file_s *file) {
         padding2(ls, ls->columns.addr);
         flushbuf(ls);
     };
-    fputs(txt, ls->flist);
+    fputs(ls->ev->u.txt, ls->flist);
     if (file != NULL) argv_print(file->name, ls->flist);
     newline(ls);
     newline(ls);
 }
+
+static void listing_reset(void) {
+    size_t i;
+    for (i = 0; i < events.p; i++) {
+        const struct listing_event_s *ev = &events.data[i];
+        if (ev->type == LISTING_EQUAL || ev->type == LISTING_EQUAL2) val_destroy(ev->u.val);
+    }
+    events.p = 0;
+    events.textp = 0;
+}
+
+void listing_pass(void) {
+    listing_reset();
+    listing_pccolumn = false;
+    nolisting = 0;
+    recording = (arguments.list.name != NULL);
+}
+
+void listing_flush(void) {
+    Listing *const ls = listing;
+    address_t old_all_mem = all_mem;
+    unsigned int old_all_mem_bits = all_mem_bits;
+    size_t i;
+    if (ls == NULL) return;
+    profile_enter(PROFILE_LISTING);
+    for (i = 0; i < events.p; i++) {
+        const struct listing_event_s *ev = &events.data[i];
+        ls->ev = ev;
+        all_mem = ev->cpu->max_address; /* for value printing */
+        all_mem_bits = (all_mem == 0xffff) ? 16 : 24;
+        ls->llist = (ev->text != SIZE_MAX) ? events.text + ev->text : ev->llist;
+        switch (ev->type) {
+        case LISTING_EQUAL: print_equal(ls); break;
+        case LISTING_EQUAL2: print_equal2(ls); break;
+        case LISTING_LINE: print_line(ls); break;
+        case LISTING_LINE_CUT: print_line_cut(ls); break;
+        case LISTING_LINE_CUT2: print_line_cut2(ls); break;
+        case LISTING_INSTR: print_instr(ls); break;
+        case LISTING_MEM: print_mem(ls); break;
+        case LISTING_FILE: print_file(ls); break;
+        }
+    }
+    all_mem = old_all_mem;
+    all_mem_bits = old_all_mem_bits;
+    listing_reset();
+    profile_leave();
+}
+
+void listing_destroy(void) {
+    listing_reset();
+    llist = NULL;
+    free(events.data);
+    free(events.text);
+    events.data = NULL;
+    events.len = 0;
+    events.text = NULL;
+    events.textlen = 0;
+}
+
+/* Only a pass which still hasn't changed anything can be the final one */
+static inline bool converging(void) {
+    return fixeddig && !constcreated;
+}
+
+static size_t listing_store(const uint8_t *data, size_t len) {
+    size_t p = events.textp;
+    if (len > events.textlen - p) {
+        size_t l;
+        if (add_overflow(p, len, &l) || add_overflow(l, l / 2 + 4096, &events.textlen)) err_msg_out_of_memory();
+        resize_array(&events.text, events.textlen);
+    }
+    memcpy(events.text + p, data, len);
+    events.textp = p + len;
+    return p;
+}
+
+static struct listing_event_s *new_event(Listing_types type) {
+    struct listing_event_s *ev;
+    if (events.p >= events.len) extend_array(&events.data, &events.len, 1024);
+    ev = &events.data[events.p++];
+    ev->type = type;
+    ev->line = lpoint.line;
+    ev->file = current_file_list->file;
+    ev->cpu = current_cpu;
+    ev->address = current_address->address;
+    ev->l_address = current_address->l_address;
+    ev->llist = NULL;
+    ev->text = SIZE_MAX;
+    if (llist == NULL) return ev;
+    if (!not_in_file(llist, ev->file)) ev->llist = llist;
+    else ev->text = listing_store(llist, strlen((const char *)llist) + 1);
+    return ev;
+}
+
+FAST_CALL void listing_equal(Obj *val) {
+    if (!recording || nolisting != 0 || !arguments.list.source || in_function || !converging()) return;
+    new_event(LISTING_EQUAL)->u.val = val_reference(val);
+    llist = NULL;
+}
+
+FAST_CALL void listing_equal2(Obj *val, linecpos_t pos) {
+    struct listing_event_s *ev;
+    if (!recording || nolisting != 0 || !arguments.list.source || in_function || !converging()) return;
+    ev = new_event(LISTING_EQUAL2);
+    ev->pos = pos;
+    ev->u.val = val_reference(val);
+    llist = NULL;
+}
+
+FAST_CALL void listing_line(linecpos_t pos) {
+    if (nolisting != 0  || in_function || llist == NULL || !arguments.list.source) return;
+    if (!converging()) return;
+    if (!listing_pccolumn) {
+        address_t addr = current_address->l_address;
+        size_t i = 0;
+        while (i < pos && (llist[i] == 0x20 || llist[i] == 0x09)) i++;
+        if (i < pos && current_address->address != addr) listing_pccolumn = true;
+    }
+    if (!recording) return;
+    new_event(LISTING_LINE)->pos = pos;
+    llist = NULL;
+}
+
+FAST_CALL void listing_line_cut(linecpos_t pos) {
+    size_t i;
+    if (nolisting != 0 || in_function || llist == NULL || !arguments.list.source) return;
+    if (!converging()) return;
+    i = 0;
+    while (i < pos && (llist[i] == 0x20 || llist[i] == 0x09)) i++;
+    if (!listing_pccolumn) {
+        if (i < pos && current_address->address != current_address->l_address) listing_pccolumn = true;
+    }
+    if (!recording) return;
+    if (i < pos) new_event(LISTING_LINE_CUT)->pos = pos;
+    llist = NULL;
+}
+
+FAST_CALL void listing_line_cut2(linecpos_t pos) {
+    if (!recording || !arguments.list.verbose || llist == NULL || !converging()) return;
+    if (nolisting == 0 && arguments.list.source && !in_function) {
+        new_event(LISTING_LINE_CUT2)->pos = pos;
+        llist = NULL;
+    }
+}
+
+void listing_instr(unsigned int cod, uint32_t adr, int ln) {
+    struct listing_event_s *ev;
+    if (nolisting != 0 || in_function || !converging()) return;
+    if (!listing_pccolumn) {
+        address_t addr = (current_address->l_address - (unsigned int)(ln + 1)) & all_mem;
+        address_t addr2 = (current_address->address - (unsigned int)(ln + 1)) & all_mem2;
+        if (addr2 != addr) listing_pccolumn = true;
+    }
+    if (!recording || (ln < 0 && !arguments.list.source)) return;
+    ev = new_event(LISTING_INSTR);
+    ev->u.instr.cod = cod;
+    ev->u.instr.adr = adr;
+    ev->u.instr.ln = ln;
+    ev->u.instr.dpage = dpage;
+    ev->u.instr.databank = databank;
+    ev->u.instr.outputeor = outputeor;
+    if (arguments.list.source) llist = NULL;
+}
+
+void listing_mem(const uint8_t *data, size_t len, address_t myaddr, address_t myaddr2) {
+    struct listing_event_s *ev;
+    if (nolisting != 0 || in_function) return;
+    if (myaddr != myaddr2) listing_pccolumn = true;
+    if (!recording || !converging()) return;
+    ev = new_event(LISTING_MEM);
+    ev->u.mem.data = listing_store(data, len);
+    ev->u.mem.len = len;
+    ev->u.mem.addr = myaddr;
+    ev->u.mem.addr2 = myaddr2;
+    if (arguments.list.source) llist = NULL;
+}
+
+void listing_file(const char *txt, const struct file_s *file) {
+    struct listing_event_s *ev;
+    if (!recording || !converging()) return;
+    ev = new_event(LISTING_FILE);
+    ev->file = file;
+    ev->u.txt = txt;
+}
@@ -31,6 +31,9 @@ extern unsigned int nolisting;
 extern const uint8_t *llist;
 extern bool listing_open(const struct list_output_s *, int, char *[]);
 extern void listing_close(const struct list_output_s *);
+extern void listing_pass(void);
+extern void listing_flush(void);
+extern void listing_destroy(void);
 extern FAST_CALL void listing_equal(struct Obj *);
 extern FAST_CALL void listing_equal2(struct Obj *, linecpos_t);
 extern FAST_CALL void listing_line(linecpos_t);
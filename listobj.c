@@ -26,10 +26,12 @@
 #include "codeobj.h"
 #include "strobj.h"
 #include "intobj.h"
+#include "floatobj.h"
 #include "typeobj.h"
 #include "noneobj.h"
 #include "errorobj.h"
 #include "foldobj.h"
+#include "rangeobj.h"
 
 static Type list_obj;
 static Type tuple_obj;
@@ -434,6 +436,71 @@ static MUST_CHECK Obj *calc1(oper_t op) {
     return val_reference(o1);
 }
 
+MUST_CHECK Obj *list_from_doubles(const Type *typ, List *inplace, const double *d, size_t len, linepos_t epoint) {
+    List *v;
+    Obj **vals;
+    size_t i;
+    if (inplace != NULL) {
+        v = ref_list(inplace);
+        vals = v->data;
+        if (vals != v->u.val) v->u.s.hash = -1;
+        for (i = 0; i < len; i++) {
+            Obj *o1 = vals[i];
+            if (o1->obj == FLOAT_OBJ && o1->refcount == 1) {
+                Float(o1)->real = d[i];
+                continue;
+            }
+            val_destroy(o1);
+            vals[i] = new_float(d[i]);
+        }
+        return Obj(v);
+    }
+    v = List(val_alloc(typ));
+    vals = lnew(v, len);
+    if (vals == NULL) return new_error_mem(epoint);
+    for (i = 0; i < len; i++) {
+        vals[i] = new_float(d[i]);
+    }
+    return Obj(v);
+}
+
+/* Float arithmetic on whole lists at once, a missing list means that the
+   operand is a scalar. Returns NULL if it must be done elementwise. */
+static MUST_CHECK Obj *calc2_float(oper_t op, List *v1, List *v2) {
+    List *list = (v1 != NULL) ? v1 : v2;
+    size_t len = list->len;
+    double *d, *d1 = NULL, *d2 = NULL, s1 = 0.0, s2 = 0.0;
+    bool f1, f2;
+    Obj *result;
+
+    switch (op->op) {
+    case O_ADD:
+    case O_SUB:
+    case O_MUL:
+    case O_DIV:
+        break;
+    default:
+        return NULL;
+    }
+    d = allocate_array(double, (v1 != NULL && v2 != NULL) ? 2 * len : len);
+    if (d == NULL) return NULL;
+    if (v1 != NULL) {
+        d1 = d;
+        if (!float_array_from_objs(d1, v1->data, len, &f1)) goto failed;
+    } else if (!float_array_from_objs(&s1, &op->v1, 1, &f1)) goto failed;
+    if (v2 != NULL) {
+        d2 = (v1 != NULL) ? d + len : d;
+        if (!float_array_from_objs(d2, v2->data, len, &f2)) goto failed;
+    } else if (!float_array_from_objs(&s2, &op->v2, 1, &f2)) goto failed;
+    if ((!f1 && !f2) || !float_array_calc2(op->op, d, d1, s1, d2, s2, len)) goto failed;
+    result = list_from_doubles(list->v.obj, (op->inplace == Obj(list)) ? list : NULL, d, len, op->epoint3);
+    free(d);
+    return result;
+failed:
+    free(d);
+    return NULL;
+}
+
 static MUST_CHECK Obj *calc2_list(oper_t op) {
     Obj *o1 = op->v1, *o2 = op->v2;
     List *v1 = List(o1), *v2 = List(o2);
@@ -471,6 +538,8 @@ static MUST_CHECK Obj *calc2_list(oper_t op) {
                     Obj **vals;
                     bool minmax = (op->op == O_MIN) || (op->op == O_MAX);
                     List *v, *inplace;
+                    Obj *result = calc2_float(op, v1, v2);
+                    if (result != NULL) return result;
                     if (op->inplace == Obj(v1)) {
                         v = ref_list(v1);
                         vals = v1->data;
@@ -865,12 +934,24 @@ static MUST_CHECK Obj *calc2(oper_t op) {
     if (o2->obj == TUPLE_OBJ || o2->obj == LIST_OBJ) {
         return calc2_list(op);
     }
+    if (o2->obj == RANGE_OBJ) {
+        Obj *result, *list = list_from_range(Range(o2));
+        op->v2 = list;
+        if (op->inplace == o2) op->inplace = NULL;
+        result = calc2_list(op);
+        val_destroy(list);
+        return result;
+    }
     if (o2 == none_value || o2->obj == ERROR_OBJ) {
         return val_reference(o2);
     }
     if (v1->len != 0) {
         bool minmax = (op->op == O_MIN) || (op->op == O_MAX), inplace = (op->inplace == o1);
         List *list;
+        if (o2->obj == FLOAT_OBJ || o2->obj == INT_OBJ) {
+            Obj *result = calc2_float(op, v1, NULL);
+            if (result != NULL) return result;
+        }
         if (inplace) {
             list = ref_list(List(o1));
             vals = list->data;
@@ -916,6 +997,10 @@ static MUST_CHECK Obj *rcalc2(oper_t op) {
     if (v2->len != 0) {
         bool minmax = (op->op == O_MIN) || (op->op == O_MAX), inplace = (op->inplace == o2);
         List *v;
+        if (o1->obj == FLOAT_OBJ || o1->obj == INT_OBJ) {
+            Obj *result = calc2_float(op, NULL, v2);
+            if (result != NULL) return result;
+        }
         if (inplace) {
             v = ref_list(List(o2));
             vals = v->data;
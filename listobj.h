@@ -77,4 +77,5 @@ extern MUST_CHECK Tuple *new_tuple(size_t);
 extern Obj **list_create_elements(List *, size_t);
 extern MUST_CHECK bool list_extend(List *);
 extern void list_shrink(List *, size_t);
+extern MUST_CHECK Obj *list_from_doubles(const struct Type *, List *, const double *, size_t, linepos_t);
 #endif
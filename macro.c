@@ -29,6 +29,8 @@
 #include "arguments.h"
 #include "optimizer.h"
 #include "main.h"
+#include "profile.h"
+#include "passtrace.h"
 
 #include "listobj.h"
 #include "typeobj.h"
@@ -42,6 +44,7 @@
 
 bool in_macro;
 bool in_function;
+Purity_types function_purity;
 
 static int functionrecursion;
 
@@ -135,26 +138,37 @@ linecpos_t macro_error_translate2(linecpos_t pos) {
 }
 
 /* ------------------------------------------------------------------------------ */
-bool mtranslate(void) {
-    unsigned int q;
-    argcount_t j, n;
-    linecpos_t p;
-    linecpos_t last;
-    struct macro_pline_s *mline;
-    bool changed, fault;
-    struct file_s *cfile = current_file_list->file;
-    const uint8_t *p2, *op, *last2;
+typedef enum Macro_ref_types {
+    MREF_PARAM, MREF_NAMED, MREF_TASM
+} Macro_ref_types;
 
-    if (lpoint.line >= cfile->lines) return true;
-    llist = pline = &cfile->source.data[cfile->line[lpoint.line]];
-    changed = !in_macro || (cfile->nomacro != NULL && (cfile->nomacro[lpoint.line / 8] & (1 << (lpoint.line & 7))) != 0);
-    lpoint.pos = 0; lpoint.line++; vline++;
-    if (changed) return signal_received;
-    mline = &macro_parameters.current->pline;
+struct macro_ref_s {
+    linecpos_t opos, olen;
+    linecpos_t cfpos, cflen;
+    argcount_t param;
+    uint8_t type;
+};
+
+struct macro_template_s {
+    argcount_t len;
+    linecpos_t end;
+    const uint8_t *cfdata;
+    struct macro_ref_s ref[1];
+};
+
+/* Collects the parameter references of a macro line, NULL if there are none */
+static struct macro_template_s *macro_template(const uint8_t *line) {
+    struct macro_template_s *tmpl;
+    struct macro_ref_s *refs = NULL;
+    uint8_t *cfdata = NULL;
+    argcount_t j, n = 0, rlen = 0;
+    size_t size, cflen = 0, cfsize = 0;
+    unsigned int q = 0;
+    const uint8_t *p2 = line, *op;
+    Macro_ref_types type;
+    str_t param, cf;
 
-    q = 0; p = 0; p2 = pline; last2 = pline; n = 0; last = 0; fault = false;
     while (*p2 != 0) {
-        str_t param;
         switch (*p2) {
         case '"':
             if ((q & 2) == 0) q ^= 1;
@@ -176,18 +190,16 @@ bool mtranslate(void) {
                 p2++;
                 continue;
             }
+            op = p2;
+            type = MREF_PARAM;
             /* normal parameter reference */
             j = (uint8_t)(p2[1] - '1');
             if (j < 9) {   /* \1..\9 */
-                p += (linecpos_t)(p2 - last2);
-                op = p2;
                 p2 += 2;
                 break;
             }
             if (j == ('@' - '1')) { /* \@ gives complete parameter list */
                 j = ALL_MACRO_PARAMS;
-                p += (linecpos_t)(p2 - last2);
-                op = p2;
                 p2 += 2;
                 break;
             }
@@ -200,25 +212,17 @@ bool mtranslate(void) {
                 param.len = get_label(param.data);
             }
             if (param.len != 0) {
-                Macro *macro = Macro(macro_parameters.current->macro);
-                str_t cf;
-                p += (linecpos_t)(p2 - last2);
-                op = p2;
                 p2 = param.data + param.len;
                 if (j == ('{' - '1')) p2++;
                 str_cfcpy(&cf, &param);
-                for (j = 0; j < macro->argc; j++) {
-                    const uint8_t *data;
-                    if (macro->param[j].cfname.len != cf.len) continue;
-                    data = macro->param[j].cfname.data;
-                    if (data[0] != cf.data[0]) continue;
-                    if (cf.len == 1 || memcmp(data, cf.data, cf.len) == 0) break;
+                if (cflen + cf.len > cfsize) {
+                    if (add_overflow(cflen, cf.len, &cfsize)) err_msg_out_of_memory();
+                    extend_array(&cfdata, &cfsize, 64);
                 }
-                if (j < macro->argc) break;
-                lpoint.pos = (linecpos_t)(op - pline);
-                err_msg_unknown_argument(&param, &lpoint);
-                p = last; last2 = p2; fault = true;
-                continue;
+                memcpy(cfdata + cflen, cf.data, cf.len);
+                type = MREF_NAMED;
+                j = 0;
+                break;
             }
             p2++;
             continue;
@@ -227,24 +231,135 @@ bool mtranslate(void) {
                 /* text parameter reference */
                 j = (uint8_t)(p2[1] - '1');
                 if (j < 9) { /* @1..@9 */
-                    p += (linecpos_t)(p2 - last2);
                     op = p2;
+                    type = MREF_TASM;
                     p2 += 2;
-                    if (j < macro_parameters.current->len) {
-                        param.data = macro_parameters.current->param[j].data;
-                        param.len = macro_parameters.current->param[j].len;
-                        if (param.len > 1 && param.data[0] == '"' && param.data[param.len-1] == '"') {
-                            param.data++;
-                            param.len -= 2;
-                        }
-                        goto tasmc;
-                    }
                     break;
                 }
             }
             p2++;
             continue;
         }
+        if (n >= rlen) extend_array(&refs, &rlen, 8);
+        refs[n].opos = (linecpos_t)(op - line);
+        refs[n].olen = (linecpos_t)(p2 - op);
+        refs[n].param = j;
+        refs[n].type = (uint8_t)type;
+        if (type == MREF_NAMED) {
+            refs[n].cfpos = (linecpos_t)cflen;
+            refs[n].cflen = (linecpos_t)cf.len;
+            cflen += cf.len;
+        } else {
+            refs[n].cfpos = refs[n].cflen = 0;
+        }
+        n++;
+    }
+    if (n == 0) return NULL;
+    while (p2 != line && (p2[-1] == 0x20 || p2[-1] == 0x09)) p2--;
+
+    if (add_overflow(sizeof *tmpl, (n - 1) * sizeof *refs, &size) || inc_overflow(&size, cflen)) err_msg_out_of_memory();
+    tmpl = (struct macro_template_s *)allocate_array(uint8_t, size);
+    if (tmpl == NULL) err_msg_out_of_memory();
+    tmpl->len = n;
+    tmpl->end = (linecpos_t)(p2 - line);
+    memcpy(tmpl->ref, refs, n * sizeof *refs);
+    tmpl->cfdata = (const uint8_t *)(tmpl->ref + n);
+    if (cflen != 0) memcpy((uint8_t *)(tmpl->ref + n), cfdata, cflen);
+    free(refs);
+    free(cfdata);
+    return tmpl;
+}
+
+/* Resolves a named reference, remembering the last parameter found */
+static argcount_t macro_named_param(struct macro_ref_s *ref, const uint8_t *cfdata) {
+    const Macro *macro = Macro(macro_parameters.current->macro);
+    argcount_t j = ref->param;
+    const uint8_t *data;
+    if (j < macro->argc && macro->param[j].cfname.len == ref->cflen && memcmp(macro->param[j].cfname.data, cfdata, ref->cflen) == 0) return j;
+    for (j = 0; j < macro->argc; j++) {
+        if (macro->param[j].cfname.len != ref->cflen) continue;
+        data = macro->param[j].cfname.data;
+        if (data[0] != cfdata[0]) continue;
+        if (ref->cflen == 1 || memcmp(data, cfdata, ref->cflen) == 0) {
+            ref->param = j;
+            break;
+        }
+    }
+    return j;
+}
+
+bool mtranslate(void) {
+    argcount_t j, i, n;
+    linecpos_t p, last;
+    struct macro_pline_s *mline;
+    struct macro_template_s *tmpl;
+    bool changed, fault;
+    struct file_s *cfile = current_file_list->file;
+    linenum_t lnum;
+    const uint8_t *last2;
+
+    if (lpoint.line >= cfile->lines) return true;
+    llist = pline = &cfile->source.data[cfile->line[lpoint.line]];
+    changed = !in_macro || (cfile->nomacro != NULL && (cfile->nomacro[lpoint.line / 8] & (1 << (lpoint.line & 7))) != 0);
+    lnum = lpoint.line;
+    lpoint.pos = 0; lpoint.line++; vline++;
+    if (changed) return signal_received;
+
+    if (cfile->mtemplate == NULL) {
+        new_array(&cfile->mtemplate, cfile->lines);
+        for (i = 0; i < cfile->lines; i++) cfile->mtemplate[i] = NULL;
+    }
+    tmpl = cfile->mtemplate[lnum];
+    if (tmpl == NULL) {
+        tmpl = macro_template(pline);
+        if (tmpl == NULL) {
+            if (cfile->nomacro == NULL) {
+                size_t l = (cfile->lines + 7) / 8;
+                new_array(&cfile->nomacro, l);
+                memset(cfile->nomacro, 0, l * sizeof *cfile->nomacro);
+            }
+            cfile->nomacro[lnum / 8] |= (uint8_t)(1U << (lnum & 7));
+            return signal_received;
+        }
+        cfile->mtemplate[lnum] = tmpl;
+    }
+    mline = &macro_parameters.current->pline;
+
+    p = 0; last = 0; last2 = pline; n = 0; fault = false;
+    if (tmpl->len > mline->rlen) {
+        mline->rlen = tmpl->len;
+        resize_array(&mline->rpositions, mline->rlen);
+    }
+    for (i = 0; i < tmpl->len; i++) {
+        struct macro_ref_s *ref = &tmpl->ref[i];
+        const uint8_t *op = pline + ref->opos;
+        str_t param;
+
+        j = ref->param;
+        switch ((Macro_ref_types)ref->type) {
+        case MREF_NAMED:
+            j = macro_named_param(ref, tmpl->cfdata + ref->cfpos);
+            if (j < Macro(macro_parameters.current->macro)->argc) break;
+            param.data = op + ((op[1] == '{') ? 2 : 1);
+            param.len = get_label(param.data);
+            lpoint.pos = ref->opos;
+            err_msg_unknown_argument(&param, &lpoint);
+            last2 = op + ref->olen; fault = true;
+            continue;
+        case MREF_TASM:
+            if (j < macro_parameters.current->len) {
+                param.data = macro_parameters.current->param[j].data;
+                param.len = macro_parameters.current->param[j].len;
+                if (param.len > 1 && param.data[0] == '"' && param.data[param.len-1] == '"') {
+                    param.data++;
+                    param.len -= 2;
+                }
+                goto tasmc;
+            }
+            break;
+        case MREF_PARAM:
+            break;
+        }
 
         if (j < macro_parameters.current->len) {
             param.data = macro_parameters.current->param[j].data;
@@ -265,6 +380,7 @@ bool mtranslate(void) {
             }
         }
     tasmc:
+        p += (linecpos_t)(op - last2);
         if (p + param.len < p) err_msg_out_of_memory(); /* overflow */
         if (p + param.len > mline->len) {
             mline->len = p + param.len;
@@ -274,16 +390,15 @@ bool mtranslate(void) {
             if (p < last) err_msg_out_of_memory(); /* overflow */
             memcpy(mline->data + last, last2, p - last);
         }
-        if (n >= mline->rlen) extend_array(&mline->rpositions, &mline->rlen, 8);
-        mline->rpositions[n].opos = (linecpos_t)(op - pline);
-        mline->rpositions[n].olen = (linecpos_t)(p2 - op);
+        mline->rpositions[n].opos = ref->opos;
+        mline->rpositions[n].olen = ref->olen;
         mline->rpositions[n].pos = p;
         mline->rpositions[n].param = j;
         mline->rpositions[n++].len = (linecpos_t)param.len;
         switch (param.len) {
         case 0:
             if (param.data == NULL) {
-                lpoint.pos = (linecpos_t)(last2 - pline) + p - last;
+                lpoint.pos = ref->opos;
                 err_msg_missing_argument(&lpoint, j);
                 fault = true;
             }
@@ -295,30 +410,18 @@ bool mtranslate(void) {
             memcpy(mline->data + p, param.data, param.len);
             p += (linecpos_t)param.len;
         }
-        last = p; last2 = p2;
+        last = p; last2 = op + ref->olen;
     }
     mline->rp = n;
-    if (last2 != pline) {
-        while (p2 != pline && (p2[-1] == 0x20 || p2[-1] == 0x09)) p2--;
-        p += (linecpos_t)(p2 - last2);
-        if (p + 1 < p) err_msg_out_of_memory(); /* overflow */
-        if (p + 1 > mline->len) {
-            if (add_overflow(p, 1024, &mline->len)) err_msg_out_of_memory();
-            resize_array(&mline->data, mline->len);
-        }
-        if (p != last) memcpy(mline->data + last, last2, p - last);
-        mline->data[p] = 0;
-        llist = pline = fault ? (const uint8_t *)"" : mline->data;
-    } else {
-        linenum_t lnum;
-        if (cfile->nomacro == NULL) {
-            size_t l = (cfile->lines + 7) / 8;
-            new_array(&cfile->nomacro, l);
-            memset(cfile->nomacro, 0, l * sizeof *cfile->nomacro);
-        }
-        lnum = lpoint.line - 1;
-        cfile->nomacro[lnum / 8] |= (uint8_t)(1U << (lnum & 7));
+    p += (linecpos_t)(pline + tmpl->end - last2);
+    if (p + 1 < p) err_msg_out_of_memory(); /* overflow */
+    if (p + 1 > mline->len) {
+        if (add_overflow(p, 1024, &mline->len)) err_msg_out_of_memory();
+        resize_array(&mline->data, mline->len);
     }
+    if (p != last) memcpy(mline->data + last, last2, p - last);
+    mline->data[p] = 0;
+    llist = pline = fault ? (const uint8_t *)"" : mline->data;
     lpoint.pos = 0;
     return signal_received;
 }
@@ -382,6 +485,7 @@ Obj *macro_recurse(Wait_types t, Obj *tmp2, Namespace *context, linepos_t epoint
     if (macro_parameters.p > 0) {
         macro_parameters.params[macro_parameters.p - 1].used = (pline == macro_parameters.params[macro_parameters.p - 1].pline.data);
     }
+    profile_macro_enter(macro->file_list->file, macro->line);
     macro_parameters.current = &macro_parameters.params[macro_parameters.p];
     macro_parameters.current->macro = val_reference(Obj(macro));
     macro_parameters.p++;
@@ -449,6 +553,7 @@ Obj *macro_recurse(Wait_types t, Obj *tmp2, Namespace *context, linepos_t epoint
         if (diagnostics.optimize) cpu_opt_invalidate();
         if (s->pass != 0 && s->addr != star) {
             if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &lpoint);
+            if (pass_tracing) pass_trace_address(NULL, &lpoint, "address", s->addr, star);
             fixeddig = false;
         }
         s->addr = star;
@@ -469,6 +574,7 @@ Obj *macro_recurse(Wait_types t, Obj *tmp2, Namespace *context, linepos_t epoint
     macro_parameters.p--;
     in_macro = in_macro_old;
     if (macro_parameters.p != 0) macro_parameters.current = &macro_parameters.params[macro_parameters.p - 1];
+    profile_macro_leave();
     return val;
 }
 
@@ -485,6 +591,7 @@ Obj *mfunc_recurse(Mfunc *mfunc, Namespace *context, uint8_t strength, linepos_t
         err_msg2(ERROR__FUNRECURSION, NULL, epoint);
         return NULL;
     }
+    profile_macro_enter(mfunc->file_list->file, mfunc->epoint.line);
     for (i = 0; i < mfunc->argc; i++) {
         const struct mfunc_param_s *param = &mfunc->param[i];
         if (param->init == default_value) {
@@ -570,6 +677,7 @@ Obj *mfunc_recurse(Mfunc *mfunc, Namespace *context, uint8_t strength, linepos_t
         if (diagnostics.optimize) cpu_opt_invalidate();
         if (s->pass != 0 && s->addr != star) {
             if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &lpoint);
+            if (pass_tracing) pass_trace_address(NULL, &lpoint, "address", s->addr, star);
             fixeddig = false;
         }
         s->addr = star;
@@ -597,6 +705,7 @@ Obj *mfunc_recurse(Mfunc *mfunc, Namespace *context, uint8_t strength, linepos_t
         lpoint.line = lin;
         in_macro = in_macro_old;
     }
+    profile_macro_leave();
     return val;
 }
 
@@ -812,9 +921,12 @@ Obj *mfunc2_recurse(Mfunc *mfunc, Funcargs *v2, linepos_t epoint) {
     argcount_t args = v2->len;
     argcount_t i;
     Label *label;
-    Tuple *tuple;
+    Tuple *tuple, *key;
     Obj *retval = NULL;
     Namespace *context;
+    Purity_types purity_old;
+    size_t messages;
+    int hash;
 
     if (mfunc->recursion_pass == pass) return NULL;
     if (functionrecursion>100) {
@@ -822,6 +934,16 @@ Obj *mfunc2_recurse(Mfunc *mfunc, Funcargs *v2, linepos_t epoint) {
         err_msg2(ERROR__FUNRECURSION, NULL, epoint);
         return NULL;
     }
+    key = mfunc_memo_key(v2, &hash);
+    if (key != NULL) {
+        retval = mfunc_memo_find(mfunc, key, hash);
+        if (retval != NULL) {
+            val_destroy(Obj(key));
+            profile_macro_enter(mfunc->file_list->file, mfunc->epoint.line);
+            profile_macro_leave();
+            return retval;
+        }
+    }
 
     if (mfunc->inamespaces == Tuple(null_tuple)) {
         val_destroy(Obj(mfunc->inamespaces));
@@ -832,6 +954,7 @@ Obj *mfunc2_recurse(Mfunc *mfunc, Funcargs *v2, linepos_t epoint) {
         if (mfunc->ipoint >= lst->len) {
             if ((lst->data == lst->u.val ? mfunc->ipoint >= lenof(lst->u.val) : mfunc->ipoint >= lst->u.s.max)) {
                 if (list_extend(lst)) {
+                    if (key != NULL) val_destroy(Obj(key));
                     err_msg2(ERROR_OUT_OF_MEMORY, NULL, epoint);
                     return ref_none();
                 }
@@ -851,6 +974,9 @@ Obj *mfunc2_recurse(Mfunc *mfunc, Funcargs *v2, linepos_t epoint) {
     }
     mfunc->ipoint++;
 
+    purity_old = function_purity;
+    function_purity = PURITY_ALWAYS;
+    messages = error_messages();
     tuple = NULL;
     for (i = 0; i < mfunc->argc; i++) {
         Obj *val;
@@ -935,6 +1061,7 @@ Obj *mfunc2_recurse(Mfunc *mfunc, Funcargs *v2, linepos_t epoint) {
     }
     if (tuple != NULL) val_destroy(Obj(tuple));
     else if (i < args) err_msg_argnum(args, i, i, &vals[i].epoint);
+    profile_macro_enter(mfunc->file_list->file, mfunc->epoint.line);
     enterfile(mfunc->file_list->file, epoint);
     {
         struct linepos_s opoint = lpoint;
@@ -950,6 +1077,7 @@ Obj *mfunc2_recurse(Mfunc *mfunc, Funcargs *v2, linepos_t epoint) {
 
         if (s->pass != 0 && s->addr != star) {
             if (fixeddig && pass > max_pass) err_msg_cant_calculate(NULL, &lpoint);
+            if (pass_tracing) pass_trace_address(NULL, &lpoint, "address", s->addr, star);
             fixeddig = false;
         }
         s->addr = star;
@@ -1028,6 +1156,15 @@ Obj *mfunc2_recurse(Mfunc *mfunc, Funcargs *v2, linepos_t epoint) {
     if (context->v.refcount == 1 && clean_namespace(context)) {
         mfunc->ipoint--;
     }
+    profile_macro_leave();
+    if (key != NULL) {
+        /* not while messages are held back, the next pass might have some */
+        if (retval != NULL && function_purity != PURITY_NONE && messages == error_messages() && ((fixeddig && !constcreated) || pass >= max_pass)) {
+            mfunc_memo_add(mfunc, key, hash, retval, function_purity == PURITY_PASS);
+        }
+        val_destroy(Obj(key));
+    }
+    if (function_purity < purity_old) function_purity = purity_old;
     return retval;
 }
 
@@ -1035,6 +1172,7 @@ void init_macro(void) {
     macro_parameters.p = 0;
     in_macro = false;
     in_function = false;
+    function_purity = PURITY_ALWAYS;
     functionrecursion = 0;
 }
 
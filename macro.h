@@ -27,8 +27,17 @@ struct Namespace;
 struct Mfunc;
 struct Obj;
 
+typedef enum Purity_types {
+    PURITY_ALWAYS, PURITY_PASS, PURITY_NONE
+} Purity_types;
+
 extern bool in_macro;
 extern bool in_function;
+extern Purity_types function_purity;
+
+static inline void function_impure(Purity_types p) {
+    if (in_function && function_purity < p) function_purity = p;
+}
 
 extern bool mtranslate(void);
 extern struct Obj *macro_recurse(Wait_types, struct Obj *, struct Namespace *, linepos_t);
@@ -46,8 +46,6 @@
 #include "console.h"
 #include "64tass.h"
 
-bool signal_received = false;
-
 #if defined _POSIX_C_SOURCE || _POSIX_VERSION >= 199506L
 #ifdef SA_RESETHAND
 #define signal_reset(signum) do {} while (false)
@@ -35,15 +35,107 @@
 #include "values.h"
 #include "memblocksobj.h"
 
-static int memblockcomp(const void *a, const void *b) {
-    address_t aa = ((const struct memblock_s *)a)->addr;
-    address_t bb = ((const struct memblock_s *)b)->addr;
+FILE *output_stream;
+
+struct memevent_s {
+    uint64_t addr;
+    size_t block;
+};
+
+static int memeventcomp(const void *a, const void *b) {
+    uint64_t aa = ((const struct memevent_s *)a)->addr;
+    uint64_t bb = ((const struct memevent_s *)b)->addr;
     if (aa < bb) return -1;
     return (aa > bb) ? 1 : 0;
 }
 
+static void memheap_push(size_t *heap, size_t *len, size_t block) {
+    size_t i = (*len)++;
+    while (i != 0) {
+        size_t parent = (i - 1) / 2;
+        if (heap[parent] >= block) break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = block;
+}
+
+static void memheap_pop(size_t *heap, size_t *len) {
+    size_t i = 0, block = heap[--(*len)];
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= *len) break;
+        if (child + 1 < *len && heap[child + 1] > heap[child]) child++;
+        if (block >= heap[child]) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = block;
+}
+
+/* Sweep over block boundaries in address order while a heap keeps the
+   latest written block covering the current position on top. This way the
+   later write wins and the result comes out sorted and free of overlaps. */
+static void memmerge(Memblocks *memblocks) {
+    size_t i, e = 0, h = 0, k = 0;
+    struct memevent_s *events;
+    struct memblock_s *blocks;
+    size_t *heap;
+
+    new_array(&events, memblocks->p * 2);
+    for (i = 0; i < memblocks->p; i++) {
+        const struct memblock_s *b = &memblocks->data[i];
+        if (b->len == 0) continue;
+        events[e].addr = b->addr;
+        events[e++].block = i;
+        events[e].addr = (uint64_t)b->addr + b->len;
+        events[e++].block = SIZE_MAX;
+    }
+    qsort(events, e, sizeof *events, memeventcomp);
+    new_array(&heap, memblocks->p);
+    new_array(&blocks, memblocks->p * 2);
+
+    for (i = 0; i < e;) {
+        const struct memblock_s *b;
+        uint64_t addr = events[i].addr;
+        address_t len, p;
+        for (; i < e && events[i].addr == addr; i++) {
+            if (events[i].block != SIZE_MAX) memheap_push(heap, &h, events[i].block);
+        }
+        while (h != 0 && (uint64_t)memblocks->data[heap[0]].addr + memblocks->data[heap[0]].len <= addr) memheap_pop(heap, &h);
+        if (h == 0 || i == e) continue;
+        b = &memblocks->data[heap[0]];
+        len = (address_t)(events[i].addr - addr);
+        p = b->p + (address_t)(addr - b->addr);
+        if (k != 0 && (uint64_t)blocks[k - 1].addr + blocks[k - 1].len == addr && blocks[k - 1].p + blocks[k - 1].len == p) {
+            blocks[k - 1].len += len;
+            continue;
+        }
+        blocks[k].p = p;
+        blocks[k].addr = (address_t)addr;
+        blocks[k].len = len;
+        blocks[k].ref = NULL;
+        k++;
+    }
+    free(heap);
+    free(events);
+    free(memblocks->data);
+    memblocks->data = blocks;
+    memblocks->len = memblocks->p * 2;
+    memblocks->p = k;
+}
+
+static inline uint64_t memblock_end(const Memblocks *memblocks, size_t i, address_t addr) {
+    const struct memblock_s *b = &memblocks->data[i];
+    return b->pos + b->len + ((addr - b->addr - b->len) & all_mem2);
+}
+
+static void memblock_pos(Memblocks *memblocks, size_t i) {
+    memblocks->data[i].pos = (i == 0) ? 0 : memblock_end(memblocks, i - 1, memblocks->data[i].addr);
+}
+
 static void memcomp(Memblocks *memblocks, bool nomerge) {
-    size_t i, j, k;
+    size_t j, k;
     if (!memblocks->flattened) {
         memblocks->flattened = true;
 
@@ -76,41 +168,13 @@ static void memcomp(Memblocks *memblocks, bool nomerge) {
                 val_destroy(Obj(b));
             }
         }
+        for (j = 0; j < memblocks->p; j++) memblock_pos(memblocks, j);
     }
     if (memblocks->p < 2 || nomerge || memblocks->merged) return;
     memblocks->merged = true;
 
-    for (k = j = 0; j < memblocks->p; j++) {
-        struct memblock_s *bj = &memblocks->data[j];
-        if (bj->len != 0) {
-            for (i = j + 1; i < memblocks->p; i++) if (memblocks->data[i].len != 0) {
-                struct memblock_s *bi = &memblocks->data[i];
-                if (bj->addr <= bi->addr && (bj->addr + bj->len) > bi->addr) {
-                    address_t overlap = (bj->addr + bj->len) - bi->addr;
-                    if (overlap > bi->len) overlap = bi->len;
-                    memcpy(memblocks->mem.data + bj->p + (bi->addr - bj->addr), memblocks->mem.data + bi->p, overlap);
-                    bi->len -= overlap;
-                    bi->p += overlap;
-                    bi->addr += overlap;
-                    continue;
-                }
-                if (bi->addr <= bj->addr && (bi->addr + bi->len) > bj->addr) {
-                    address_t overlap = bi->addr + bi->len - bj->addr;
-                    if (overlap > bj->len) overlap = bj->len;
-                    bj->addr += overlap;
-                    bj->p += overlap;
-                    bj->len -= overlap;
-                    if (bj->len == 0) break;
-                }
-            }
-            if (bj->len != 0) {
-                if (j != k) memblocks->data[k] = *bj;
-                k++;
-            }
-        }
-    }
-    memblocks->p = k;
-    qsort(memblocks->data, memblocks->p, sizeof *memblocks->data, memblockcomp);
+    memmerge(memblocks);
+    for (j = 0; j < memblocks->p; j++) memblock_pos(memblocks, j);
 }
 
 void memjmp(Memblocks *memblocks, address_t adr) {
@@ -125,6 +189,7 @@ void memjmp(Memblocks *memblocks, address_t adr) {
     block->p = memblocks->lastp;
     block->ref = NULL;
     block->addr = memblocks->lastaddr;
+    memblock_pos(memblocks, memblocks->p - 1);
     memblocks->lastp = memblocks->mem.p;
     memblocks->lastaddr = adr;
 }
@@ -146,6 +211,7 @@ void memref(Memblocks *memblocks, Memblocks *ref, address_t addr, address_t ln)
     block->p = memblocks->lastp;
     block->ref = Memblocks(val_reference(Obj(ref)));
     block->addr = addr;
+    memblock_pos(memblocks, memblocks->p - 1);
 }
 
 #if defined _POSIX_C_SOURCE || defined __unix__
@@ -670,12 +736,16 @@ static void output_mem_srec(FILE *fout, const Memblocks *memblocks, const struct
 void output_mem(Memblocks *memblocks, const struct output_s *output) {
     FILE* fout;
     bool binary = (output->mode != OUTPUT_IHEX) && (output->mode != OUTPUT_SREC);
+    bool captured = (output_stream != NULL);
     int err;
 #ifdef SETMODE_AVAILABLE
     int oldmode = -1;
 #endif
 
-    if (dash_name(output->name)) {
+    if (captured) {
+        fout = output_stream;
+        output_stream = NULL; /* only the first output is captured */
+    } else if (dash_name(output->name)) {
         if (fflush(stdout) != 0 || binary) setvbuf(stdout, NULL, binary ? _IOFBF : _IOLBF, binary ? BUFSIZ : 1024);
 #ifdef SETMODE_AVAILABLE
         if (binary) oldmode = setmode(STDOUT_FILENO, O_BINARY);
@@ -707,7 +777,7 @@ void output_mem(Memblocks *memblocks, const struct output_s *output) {
     case OUTPUT_MHEX: output_mem_mhex(fout, memblocks); break;
     }
     err = ferror(fout);
-    err |= (fout != stdout) ? fclose(fout) : fflush(fout);
+    err |= (fout != stdout && !captured) ? fclose(fout) : fflush(fout);
     if (err != 0 && errno != 0) err_msg_file2(ERROR_CANT_WRTE_OBJ, output->name, &output->name_pos);
 #ifdef SETMODE_AVAILABLE
     if (oldmode >= 0) setmode(STDOUT_FILENO, oldmode);
@@ -747,9 +817,12 @@ size_t get_mem(const Memblocks *memblocks) {
     return memblocks->p;
 }
 
-int read_mem(const Memblocks *memblocks, address_t raddr, size_t membp, address_t offs) {
-    address_t addr, diff;
-    address_t len;
+/* Blocks are laid out one after the other with the gaps between them
+   counted in. A binary search on these positions finds the block. */
+static const uint8_t *locate_mem(const Memblocks *memblocks, address_t raddr, size_t membp, address_t offs, address_t *ln) {
+    address_t addr, diff, len;
+    uint64_t pos, last;
+    size_t end;
     if (membp < memblocks->p) {
         addr = memblocks->data[membp].addr;
     } else {
@@ -759,23 +832,42 @@ int read_mem(const Memblocks *memblocks, address_t raddr, size_t membp, address_
         offs += raddr - addr;
         raddr = addr;
     }
-    for (; membp < memblocks->p; membp++) {
-        addr = memblocks->data[membp].addr;
-        diff = (addr - raddr) & all_mem2;
-        if (diff > offs) return -1;
-        offs -= diff;
-        len = memblocks->data[membp].len;
-        if (offs < len) return memblocks->mem.data[memblocks->data[membp].p + offs];
-        offs -= len;
-        raddr = (addr + len) & all_mem2;
-    }
-    addr = memblocks->lastaddr;
     diff = (addr - raddr) & all_mem2;
-    if (diff > offs) return -1;
+    if (diff > offs) return NULL;
     offs -= diff;
+    end = memblocks->p;
+    last = (end == 0) ? 0 : memblock_end(memblocks, end - 1, memblocks->lastaddr);
+    pos = ((membp < end) ? memblocks->data[membp].pos : last) + offs;
+    if (pos < last) {
+        const struct memblock_s *b;
+        while (end - membp > 1) {
+            size_t mid = membp + (end - membp) / 2;
+            if (memblocks->data[mid].pos <= pos) membp = mid; else end = mid;
+        }
+        b = &memblocks->data[membp];
+        pos -= b->pos;
+        if (pos >= b->len) return NULL;
+        *ln = b->len - (address_t)pos;
+        return memblocks->mem.data + b->p + pos;
+    }
+    pos -= last;
     len = memblocks->mem.p - memblocks->lastp;
-    if (offs < len) return memblocks->mem.data[memblocks->lastp + offs];
-    return -1;
+    if (pos >= len) return NULL;
+    *ln = len - (address_t)pos;
+    return memblocks->mem.data + memblocks->lastp + pos;
+}
+
+address_t copy_mem(uint8_t *dest, const Memblocks *memblocks, address_t raddr, size_t membp, address_t offs, address_t len) {
+    address_t i = 0;
+    while (i < len) {
+        address_t ln;
+        const uint8_t *d = locate_mem(memblocks, raddr, membp, offs + i, &ln);
+        if (d == NULL) break;
+        if (ln > len - i) ln = len - i;
+        memcpy(dest + i, d, ln);
+        i += ln;
+    }
+    return i;
 }
 
 void write_mark_mem(const struct mem_mark_s *mm, Memblocks *memblocks, unsigned int c) {
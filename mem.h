@@ -18,6 +18,7 @@
 */
 #ifndef MEM_H
 #define MEM_H
+#include <stdio.h>
 #include "attributes.h"
 #include "inttypes.h"
 
@@ -30,6 +31,8 @@ struct mem_mark_s {
     address_t oaddr, oaddr2, olastaddr;
 };
 
+extern FILE *output_stream;
+
 extern void mark_mem(struct mem_mark_s *, const struct Memblocks *, address_t, address_t);
 extern void write_mark_mem(const struct mem_mark_s *, struct Memblocks *, unsigned int);
 extern void list_mem(const struct mem_mark_s *, const struct Memblocks *);
@@ -38,6 +41,6 @@ extern void memjmp(struct Memblocks *, address_t);
 extern void memref(struct Memblocks *, struct Memblocks *, address_t, address_t);
 extern void output_mem(struct Memblocks *, const struct output_s *);
 extern FAST_CALL uint8_t *alloc_mem(struct Memblocks *, address_t);
-extern int read_mem(const struct Memblocks *, address_t, size_t, address_t);
+extern address_t copy_mem(uint8_t *, const struct Memblocks *, address_t, size_t, address_t, address_t);
 extern size_t get_mem(const struct Memblocks *);
 #endif
@@ -75,33 +75,6 @@ MUST_CHECK Memblocks *new_memblocks(address_t ln, size_t ln2) {
     return val;
 }
 
-MUST_CHECK Memblocks *copy_memblocks(Memblocks *m) {
-    Memblocks *val = Memblocks(val_alloc(MEMBLOCKS_OBJ));
-    size_t i;
-    val->mem.p = m->mem.p;
-    val->mem.len = m->mem.len;
-    if (m->mem.len == 0) val->mem.data = NULL;
-    else {
-        new_array(&val->mem.data, m->mem.len);
-        memcpy(val->mem.data, m->mem.data, m->mem.len);
-    }
-    val->p = m->p;
-    val->len = m->p;
-    val->lastp = m->lastp;
-    val->lastaddr = m->lastaddr;
-    if (m->p == 0) val->data = NULL; else new_array(&val->data, m->p);
-    val->flattened = m->flattened;
-    val->merged = m->merged;
-    val->enumeration = m->enumeration;
-    val->section = m->section;
-    for (i = 0; i < m->p; i++) {
-        const struct memblock_s *b = &m->data[i];
-        val->data[i] = m->data[i];
-        if (b->ref != NULL) val->data[i].ref = copy_memblocks(b->ref);
-    }
-    return val;
-}
-
 struct memblocks_print_s {
     FILE *f;
     unsigned int level;
@@ -30,6 +30,7 @@ extern struct Type *const MEMBLOCKS_OBJ;
 struct memblock_s { /* starts and sizes */
     address_t p;
     address_t addr, len;
+    uint64_t pos;  /* distance from first block including gaps */
     struct Memblocks *ref;
 };
 
@@ -56,7 +57,6 @@ static inline Memblocks *ref_memblocks(Memblocks *v1) {
 }
 
 extern MUST_CHECK Memblocks *new_memblocks(address_t, size_t);
-extern MUST_CHECK Memblocks *copy_memblocks(Memblocks *);
 extern void printmemorymap(const Memblocks *);
 extern void memorymapfile(const Memblocks *, const struct output_s *);
 #endif
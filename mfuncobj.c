@@ -23,10 +23,13 @@
 #include "error.h"
 #include "macro.h"
 #include "file.h"
+#include "64tass.h"
 
 #include "typeobj.h"
 #include "namespaceobj.h"
 #include "listobj.h"
+#include "floatobj.h"
+#include "addressobj.h"
 
 static Type mfunc_obj;
 static Type sfunc_obj;
@@ -34,6 +37,16 @@ static Type sfunc_obj;
 Type *const MFUNC_OBJ = &mfunc_obj;
 Type *const SFUNC_OBJ = &sfunc_obj;
 
+/* cached result of a call, pass is 0 if it's valid in all passes */
+struct mfunc_memo_s {
+    int hash;
+    uint8_t pass;
+    Tuple *key;
+    Obj *val;
+};
+
+#define MEMO_MAX 0x10000
+
 static FAST_CALL void destroy(Obj *o1) {
     Mfunc *v1 = Mfunc(o1);
     const struct file_s *cfile = v1->file_list->file;
@@ -55,6 +68,15 @@ static FAST_CALL void destroy(Obj *o1) {
     val_destroy(Obj(v1->inamespaces));
     free(v1->param);
     if (v1->line != NULL) free((uint8_t *)v1->line);
+    if (v1->memo != NULL) {
+        size_t n;
+        for (n = 0; n <= v1->memomask; n++) {
+            if (v1->memo[n].key == NULL) continue;
+            val_destroy(Obj(v1->memo[n].key));
+            val_destroy(v1->memo[n].val);
+        }
+        free(v1->memo);
+    }
 }
 
 static FAST_CALL void garbage(Obj *o1, int j) {
@@ -80,6 +102,15 @@ static FAST_CALL void garbage(Obj *o1, int j) {
         v->refcount--;
         v = Obj(v1->inamespaces);
         v->refcount--;
+        if (v1->memo != NULL) {
+            for (k = 0; k <= v1->memomask; k++) {
+                if (v1->memo[k].key == NULL) continue;
+                v = Obj(v1->memo[k].key);
+                v->refcount--;
+                v = v1->memo[k].val;
+                v->refcount--;
+            }
+        }
         return;
     case 0:
         cfile = v1->file_list->file;
@@ -91,6 +122,7 @@ static FAST_CALL void garbage(Obj *o1, int j) {
         free(v1->param);
         free(v1->namespaces);
         if (v1->line != NULL) free((uint8_t *)v1->line);
+        free(v1->memo);
         return;
     case 1:
         while ((i--) != 0) {
@@ -127,6 +159,21 @@ static FAST_CALL void garbage(Obj *o1, int j) {
             v->refcount -= SIZE_MSB - 1;
             v->obj->garbage(v, 1);
         } else v->refcount++;
+        if (v1->memo != NULL) {
+            for (k = 0; k <= v1->memomask; k++) {
+                if (v1->memo[k].key == NULL) continue;
+                v = Obj(v1->memo[k].key);
+                if ((v->refcount & SIZE_MSB) != 0) {
+                    v->refcount -= SIZE_MSB - 1;
+                    v->obj->garbage(v, 1);
+                } else v->refcount++;
+                v = v1->memo[k].val;
+                if ((v->refcount & SIZE_MSB) != 0) {
+                    v->refcount -= SIZE_MSB - 1;
+                    v->obj->garbage(v, 1);
+                } else v->refcount++;
+            }
+        }
         return;
     }
 }
@@ -152,6 +199,147 @@ static FAST_CALL bool same(const Obj *o1, const Obj *o2) {
     return true;
 }
 
+/* Only immutable values which don't depend on anything else are remembered */
+static bool memo_value(const Obj *o1) {
+    switch (o1->obj->type) {
+    case T_BOOL:
+    case T_INT:
+    case T_BITS:
+    case T_FLOAT:
+    case T_STR:
+    case T_BYTES:
+    case T_RANGE:
+        return true;
+    case T_ADDRESS:
+        return memo_value(Address(o1)->val);
+    case T_LIST:
+    case T_TUPLE:
+        {
+            const List *v1 = List(o1);
+            size_t i;
+            for (i = 0; i < v1->len; i++) {
+                if (!memo_value(v1->data[i])) return false;
+            }
+            return true;
+        }
+    default:
+        return false;
+    }
+}
+
+/* Like same but tells -0.0 and 0.0 apart */
+static bool memo_same(const Obj *o1, const Obj *o2) {
+    if (o1 == o2) return true;
+    if (o1->obj != o2->obj) return false;
+    switch (o1->obj->type) {
+    case T_FLOAT:
+        return memcmp(&Float(o1)->real, &Float(o2)->real, sizeof Float(o1)->real) == 0;
+    case T_ADDRESS:
+        return Address(o1)->type == Address(o2)->type && memo_same(Address(o1)->val, Address(o2)->val);
+    case T_LIST:
+    case T_TUPLE:
+        {
+            const List *v1 = List(o1), *v2 = List(o2);
+            size_t i;
+            if (v1->len != v2->len) return false;
+            for (i = 0; i < v1->len; i++) {
+                if (!memo_same(v1->data[i], v2->data[i])) return false;
+            }
+            return true;
+        }
+    default:
+        return o1->obj->same(o1, o2);
+    }
+}
+
+MUST_CHECK Tuple *mfunc_memo_key(const Funcargs *v2, int *hs) {
+    const struct values_s *vals = v2->val;
+    argcount_t i, args = v2->len;
+    unsigned int h = args;
+    Tuple *key;
+    for (i = 0; i < args; i++) {
+        int h2;
+        Obj *v = vals[i].val, *err;
+        if (!memo_value(v)) return NULL;
+        err = v->obj->hash(v, &h2, &vals[i].epoint);
+        if (err != NULL) {
+            val_destroy(err);
+            return NULL;
+        }
+        h = h * 31 + (unsigned int)h2;
+    }
+    *hs = (int)(h & ((~0U) >> 1));
+    key = new_tuple(args);
+    for (i = 0; i < args; i++) {
+        key->data[i] = val_reference(vals[i].val);
+    }
+    return key;
+}
+
+static struct mfunc_memo_s *memo_slot(const Mfunc *v1, const Tuple *key, int hs) {
+    size_t mask = v1->memomask;
+    size_t hash = (size_t)hs;
+    size_t offs = hash & mask;
+    while (v1->memo[offs].key != NULL) {
+        struct mfunc_memo_s *d = &v1->memo[offs];
+        if (d->hash == hs && memo_same(Obj(d->key), Obj(key))) return d;
+        hash >>= 5;
+        offs = (5 * offs + hash + 1) & mask;
+    }
+    return &v1->memo[offs];
+}
+
+MUST_CHECK Obj *mfunc_memo_find(const Mfunc *v1, const Tuple *key, int hs) {
+    const struct mfunc_memo_s *d;
+    if (v1->memo == NULL) return NULL;
+    d = memo_slot(v1, key, hs);
+    if (d->key == NULL || (d->pass != 0 && d->pass != pass)) return NULL;
+    if (d->pass != 0) function_impure(PURITY_PASS);
+    return val_reference(d->val);
+}
+
+static bool memo_resize(Mfunc *v1) {
+    struct mfunc_memo_s *old = v1->memo, *n;
+    size_t i, oldmask = v1->memomask, max = (old == NULL) ? 8 : (oldmask + 1) << 1;
+    n = allocate_array(struct mfunc_memo_s, max);
+    if (n == NULL) return true;
+    for (i = 0; i < max; i++) n[i].key = NULL;
+    v1->memo = n;
+    v1->memomask = max - 1;
+    v1->memolen = 0;
+    if (old == NULL) return false;
+    for (i = 0; i <= oldmask; i++) {
+        struct mfunc_memo_s *d = &old[i];
+        if (d->key == NULL) continue;
+        if (d->pass != 0 && d->pass != pass) {
+            val_destroy(Obj(d->key));
+            val_destroy(d->val);
+            continue;
+        }
+        *memo_slot(v1, d->key, d->hash) = *d;
+        v1->memolen++;
+    }
+    free(old);
+    return false;
+}
+
+void mfunc_memo_add(Mfunc *v1, Tuple *key, int hs, Obj *val, bool passonly) {
+    struct mfunc_memo_s *d;
+    if (!memo_value(val)) return;
+    if (v1->memolen * 3 / 2 >= v1->memomask) {
+        if (v1->memolen >= MEMO_MAX || memo_resize(v1)) return;
+    }
+    d = memo_slot(v1, key, hs);
+    if (d->key != NULL) {
+        val_destroy(Obj(d->key));
+        val_destroy(d->val);
+    } else v1->memolen++;
+    d->hash = hs;
+    d->pass = passonly ? pass : 0;
+    d->key = Tuple(val_reference(Obj(key)));
+    d->val = val_reference(val);
+}
+
 static MUST_CHECK Obj *contains(oper_t op) {
     Obj *o1 = op->v1;
     Mfunc *v2 = Mfunc(op->v2);
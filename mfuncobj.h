@@ -46,6 +46,8 @@ typedef struct Mfunc {
     size_t ipoint;
     struct List *inamespaces;
     const uint8_t *line;
+    size_t memolen, memomask;
+    struct mfunc_memo_s *memo;
 } Mfunc;
 typedef struct Mfunc Sfunc;
 
@@ -53,4 +55,7 @@ typedef struct Mfunc Sfunc;
 #define Sfunc(a) OBJ_CAST(Sfunc, a)
 
 extern void mfuncobj_init(void);
+extern MUST_CHECK struct List *mfunc_memo_key(const Funcargs *, int *);
+extern MUST_CHECK Obj *mfunc_memo_find(const Mfunc *, const struct List *, int);
+extern void mfunc_memo_add(Mfunc *, struct List *, int, Obj *, bool);
 #endif
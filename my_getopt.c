@@ -69,8 +69,8 @@ static int my_getopt(int argc, char *argv[], const char *opts)
           charind = 0;
           if (++my_optind >= argc) {
             if (my_opterr) {fatal_error("option '-");
-                            putc(my_optopt, stderr);
-                            fputs("' requires an argument", stderr); fatal_error(NULL); }
+                            putc(my_optopt, error_file());
+                            fputs("' requires an argument", error_file()); fatal_error(NULL); }
             opt = (colon_mode == ':') ? ':' : '?';
             goto my_getopt_ok;
           }
@@ -81,8 +81,8 @@ static int my_getopt(int argc, char *argv[], const char *opts)
       goto my_getopt_ok;
     }
     if (my_opterr) {fatal_error("option '-");
-                    printable_print2((const uint8_t *)argv[my_optind] + charind, stderr, ((my_optopt & 0x80) != 0) ? utf8len((unsigned char)my_optopt) : 1);
-                    fputs("' not recognized", stderr); fatal_error(NULL); }
+                    printable_print2((const uint8_t *)argv[my_optind] + charind, error_file(), ((my_optopt & 0x80) != 0) ? utf8len((unsigned char)my_optopt) : 1);
+                    fputs("' not recognized", error_file()); fatal_error(NULL); }
     opt = '?';
     if (argv[my_optind][++charind] == '\0') {
       my_optind++;
@@ -225,8 +225,8 @@ int my_getopt_long(int argc, char *argv[], const char *shortopts,
         if (longopts[found].has_arg == my_no_argument) {
           opt = '?';
           if (my_opterr) {fatal_error("option '--");
-                         printable_print((const uint8_t *)longopts[found].name, stderr);
-                         fputs("' doesn't allow an argument", stderr); fatal_error(NULL); }
+                         printable_print((const uint8_t *)longopts[found].name, error_file());
+                         fputs("' doesn't allow an argument", error_file()); fatal_error(NULL); }
         } else {
           my_optarg = argv[my_optind] + ++charind;
           /*charind = 0;*/
@@ -235,8 +235,8 @@ int my_getopt_long(int argc, char *argv[], const char *shortopts,
         if (++my_optind >= argc) {
           opt = (colon_mode == ':') ? ':' : '?';
           if (my_opterr) {fatal_error("option '--");
-                         printable_print((const uint8_t *)longopts[found].name, stderr);
-                         fputs("' requires an argument", stderr); fatal_error(NULL); }
+                         printable_print((const uint8_t *)longopts[found].name, error_file());
+                         fputs("' requires an argument", error_file()); fatal_error(NULL); }
         } else my_optarg = argv[my_optind];
       }
       if (opt == 0) {
@@ -250,14 +250,14 @@ int my_getopt_long(int argc, char *argv[], const char *shortopts,
       else {
         opt = '?';
         if (my_opterr) {fatal_error("option '");
-                       printable_print((const uint8_t *)argv[my_optind++], stderr);
-                       fputs("' not recognized", stderr); fatal_error(NULL); }
+                       printable_print((const uint8_t *)argv[my_optind++], error_file());
+                       fputs("' not recognized", error_file()); fatal_error(NULL); }
       }
     } else {
       opt = '?';
       if (my_opterr) {fatal_error("option '");
-                     printable_print((const uint8_t *)argv[my_optind++], stderr);
-                     fputs("' is ambiguous", stderr); fatal_error(NULL); }
+                     printable_print((const uint8_t *)argv[my_optind++], error_file());
+                     fputs("' is ambiguous", error_file()); fatal_error(NULL); }
     }
   }
   if (my_optind > argc) my_optind = argc;
@@ -27,6 +27,7 @@
 #include "macroobj.h"
 #include "intobj.h"
 #include "listobj.h"
+#include "rangeobj.h"
 #include "namespaceobj.h"
 #include "addressobj.h"
 #include "codeobj.h"
@@ -322,6 +323,7 @@ void objects_init(void) {
     strobj_init();
     registerobj_init();
     listobj_init();
+    rangeobj_init();
     bytesobj_init();
     bitsobj_init();
     intobj_init();
@@ -50,6 +50,32 @@ static const uint32_t mnemonic_w65816[] = {
     0x776169, 0x77646d, 0x786261, 0x786365
 };
 
+static const uint8_t mnemonic_hash_w65816[1 << MNEMONIC_HASH_BITS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 5, 0, 0, 24, 0, 0, 0, 82, 0, 0, 90, 111,
+    105, 0, 30, 0, 0, 79, 0, 0, 20, 0, 0, 22, 0, 17, 0, 0, 108, 0, 0, 0, 88, 0,
+    0, 0, 0, 0, 0, 73, 13, 0, 41, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 86, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 44, 0, 0, 1, 0, 46, 28, 103, 0, 0, 0, 0, 77, 94, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0,
+    122, 0, 83, 0, 0, 119, 0, 0, 0, 0, 0, 0, 3, 0, 8, 0, 96, 115, 0, 0, 0, 27,
+    0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 12, 0,
+    0, 0, 0, 0, 65, 0, 0, 0, 36, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 123, 0, 0, 0,
+    0, 50, 0, 0, 29, 0, 0, 0, 0, 45, 98, 0, 0, 0, 0, 76, 0, 0, 61, 0, 0, 0, 85,
+    0, 0, 43, 25, 0, 32, 0, 0, 0, 0, 10, 0, 7, 69, 0, 2, 0, 71, 66, 0, 0, 67,
+    121, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 9, 0, 49, 102, 0, 0, 0, 0, 0, 110, 0,
+    0, 0, 116, 101, 75, 62, 104, 0, 95, 117, 93, 0, 0, 0, 19, 0, 0, 0, 0, 0,
+    23, 0, 0, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    114, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 97, 0, 11, 0, 100, 0, 0, 0, 60, 0,
+    0, 0, 0, 6, 18, 0, 0, 0, 0, 107, 0, 0, 0, 0, 0, 124, 0, 0, 63, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 113, 0, 4, 0, 120, 0, 0, 0, 0, 0, 109,
+    0, 0, 0, 42, 99, 0, 0, 0, 0, 89, 0, 0, 31, 0, 0, 0, 16, 0, 0, 0, 0, 0, 34,
+    0, 0, 0, 0, 87, 0, 0, 0, 0, 0, 0, 53, 64, 0, 0, 0, 0, 0, 15, 48, 0, 0, 112,
+    0, 0, 0, 26, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 38, 91, 0, 0, 106,
+    78, 0, 118, 0, 80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 72,
+    0, 0, 74, 0, 0, 52, 0, 14, 81
+};
+
 static const uint16_t disasm_w65816[] = {
     525, 2366, 536, 2622, 1392, 1342, 1282, 4414, 327, 574, 2, 325, 1136, 1086,
     1026, 830, 4875, 3646, 3902, 2878, 1390, 2110, 2050, 4158, 273, 3134, 47,
@@ -86,6 +112,8 @@ static const uint8_t alias_w65816[] = {
 const struct cpu_s w65816 = {
     "65816",
     mnemonic_w65816,
+    mnemonic_hash_w65816,
+    0xe3bd47e3,
     opcode_w65816,
     disasm_w65816,
     alias_w65816,
@@ -119,6 +147,31 @@ static const uint32_t mnemonic_c6502[] = {
     0x747378, 0x747861, 0x747873, 0x747961
 };
 
+static const uint8_t mnemonic_hash_c6502[1 << MNEMONIC_HASH_BITS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0,
+    0, 0, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 45, 9, 0, 0, 0, 0,
+    0, 0, 0, 60, 36, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 37, 0, 0, 47, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 64,
+    0, 0, 0, 71, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 50, 65, 0, 0,
+    0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 52, 34, 0, 0, 61, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 22, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 38,
+    44, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0,
+    35, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11,
+    0, 0, 0, 0, 27, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 6, 19, 0, 0, 0, 55, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 0, 0, 31, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 3, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 48,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 2, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0,
+    0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 29, 0, 13, 0, 0, 0, 57, 0, 0, 56, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 42, 72, 0, 0, 0, 26, 0, 0, 0, 0, 59,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0,
+    0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 23, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 5, 0, 0,
+    0, 0, 67, 66, 0, 0, 0, 0, 0, 0, 0
+};
+
 static const uint16_t disasm_c6502[] = {
     524, 2352, 303, 303, 303, 1328, 1282, 303, 307, 560, 2, 303, 303, 1072,
     1026, 303, 4875, 3632, 303, 303, 303, 2096, 2050, 303, 271, 3120, 303, 303,
@@ -151,6 +204,8 @@ static const uint8_t alias_c6502[] = {
 const struct cpu_s c6502 = {
     "6502",
     mnemonic_c6502,
+    mnemonic_hash_c6502,
+    0xa06328b1,
     opcode_c6502,
     disasm_c6502,
     alias_c6502,
@@ -186,6 +241,31 @@ static const uint32_t mnemonic_c65c02[] = {
     0x746178, 0x746179, 0x747262, 0x747362, 0x747378, 0x747861, 0x747873, 0x747961
 };
 
+static const uint8_t mnemonic_hash_c65c02[1 << MNEMONIC_HASH_BITS] = {
+    76, 0, 0, 85, 0, 0, 28, 0, 79, 0, 0, 0, 9, 0, 0, 75, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 31, 0, 0, 84, 0, 63, 12, 0, 22, 0, 42,
+    0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0,
+    17, 0, 0, 0, 0, 0, 61, 0, 0, 40, 0, 0, 0, 0, 0, 0, 50, 77, 0, 0, 83, 0, 0,
+    0, 0, 0, 14, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0,
+    0, 0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 71, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 78, 8, 0, 0, 0, 0, 0, 0, 21, 0, 37, 23, 0, 0, 0, 0, 0, 0, 0, 0,
+    25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 26, 0, 87, 0, 0, 0, 0, 34, 0, 29, 0,
+    80, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 67, 0, 0, 0, 0, 73,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 88, 1, 30, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 56, 0, 0, 65, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 0, 0, 0,
+    0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 81, 0, 18, 0, 0, 0, 0, 0, 0, 0,
+    48, 0, 32, 0, 0, 0, 0, 46, 51, 0, 0, 0, 0, 0, 0, 0, 54, 74, 86, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 70, 57, 64, 0, 0, 0, 0, 13, 36, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    41, 0, 0, 0, 72, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 35, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 49, 0, 0, 0, 0, 24,
+    16, 0, 0, 0, 53, 0, 0, 0, 38, 0, 0, 55, 0, 0
+};
+
 static const uint16_t disasm_c65c02[] = {
     525, 2357, 308, 308, 1363, 1333, 1282, 308, 312, 565, 2, 308, 1107, 1077,
     1026, 308, 4875, 3637, 3893, 308, 1362, 2101, 2050, 308, 272, 3125, 42, 308,
@@ -219,6 +299,8 @@ static const uint8_t alias_c65c02[] = {
 const struct cpu_s c65c02 = {
     "65c02",
     mnemonic_c65c02,
+    mnemonic_hash_c65c02,
+    0x8ad961b3,
     opcode_c65c02,
     disasm_c65c02,
     alias_c65c02,
@@ -259,6 +341,31 @@ static const uint32_t mnemonic_c6502i[] = {
     0x747961, 0x786161
 };
 
+static const uint8_t mnemonic_hash_c6502i[1 << MNEMONIC_HASH_BITS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 35, 0, 60,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 1, 0, 0, 0, 28, 0,
+    0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 15, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95,
+    0, 0, 31, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 0, 0, 0, 0, 0, 0,
+    21, 0, 0, 3, 0, 0, 0, 0, 0, 63, 0, 0, 61, 0, 0, 0, 27, 0, 0, 59, 0, 0, 47,
+    0, 12, 0, 41, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 78, 0, 65, 0, 0, 0, 0, 106, 0, 100, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0,
+    0, 0, 51, 0, 0, 70, 0, 0, 0, 37, 0, 0, 81, 0, 0, 0, 105, 0, 0, 36, 9, 0, 0,
+    8, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0, 0, 0, 0, 0, 0,
+    101, 0, 0, 99, 0, 0, 16, 0, 0, 0, 0, 40, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 79, 0, 91, 0, 89, 0, 0, 88, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 74, 0, 75, 0, 0, 0, 39, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0,
+    66, 46, 0, 25, 0, 23, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32,
+    0, 0, 0, 0, 0, 0, 43, 71, 0, 0, 0, 0, 0, 0, 86, 0, 84, 0, 0, 58, 92, 0, 90,
+    0, 0, 0, 0, 0, 0, 20, 87, 0, 0, 0, 0, 49, 0, 0, 0, 0, 44, 14, 0, 0, 0, 0,
+    0, 0, 0, 77, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 24, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 10, 0, 83, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 93, 64, 22, 85, 0, 69, 0, 0, 57, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0,
+    0, 34, 50, 0, 0, 48, 54, 104, 0, 0, 0, 18, 94, 0, 0, 103, 29, 0, 0, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 6, 0, 0, 45, 53, 97, 0, 96,
+    0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 38, 0
+};
+
 static const uint16_t disasm_c6502i[] = {
     531, 2370, 308, 2396, 1345, 1346, 1287, 1372, 325, 578, 7, 515, 1089, 1090,
     1031, 1116, 4882, 3650, 321, 3676, 2113, 2114, 2055, 2140, 278, 3138, 321,
@@ -294,6 +401,8 @@ static const uint8_t alias_c6502i[] = {
 const struct cpu_s c6502i = {
     "6502i",
     mnemonic_c6502i,
+    mnemonic_hash_c6502i,
+    0x2a73f3c9,
     opcode_c6502i,
     disasm_c6502i,
     alias_c6502i,
@@ -332,6 +441,31 @@ static const uint32_t mnemonic_c65dtv02[] = {
     0x786161
 };
 
+static const uint8_t mnemonic_hash_c65dtv02[1 << MNEMONIC_HASH_BITS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0,
+    0, 0, 0, 54, 0, 0, 0, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 0,
+    0, 4, 0, 0, 42, 81, 0, 0, 24, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 83, 0,
+    0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 0, 0,
+    0, 0, 60, 33, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 0, 18,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 11, 44, 0, 0, 0, 0, 0, 0, 17, 0,
+    61, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 35, 52, 34,
+    0, 0, 0, 0, 37, 0, 92, 0, 0, 0, 82, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    97, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95,
+    0, 57, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 6, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 46, 0, 0,
+    0, 66, 0, 93, 0, 0, 70, 75, 0, 27, 0, 16, 0, 21, 77, 0, 0, 0, 0, 0, 0, 0,
+    15, 0, 0, 84, 0, 0, 12, 50, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 80, 0, 0, 0, 48, 74, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 29, 5, 0, 0, 0, 0, 0, 53, 0, 55, 0, 0, 59,
+    88, 19, 0, 0, 31, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 40, 90, 0, 0, 63, 0,
+    38, 0, 0, 25, 0, 87, 8, 43, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 28, 0, 0, 0,
+    22, 0, 0, 62, 0, 26, 0, 0, 0, 68, 0, 0, 0, 0, 32, 0, 51, 0, 0, 0, 0, 0, 0,
+    0, 0, 67, 0, 72, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 78, 49, 0, 0, 0, 0, 0, 45,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0
+};
+
 static const uint16_t disasm_c65dtv02[] = {
     529, 2365, 316, 2388, 316, 1341, 1285, 1364, 320, 573, 5, 316, 316, 1085,
     1029, 1108, 4879, 3645, 4880, 3668, 316, 2109, 2053, 2132, 276, 3133, 316,
@@ -366,6 +500,8 @@ static const uint8_t alias_c65dtv02[] = {
 const struct cpu_s c65dtv02 = {
     "65dtv02",
     mnemonic_c65dtv02,
+    mnemonic_hash_c65dtv02,
+    0x4a788127,
     opcode_c65dtv02,
     disasm_c65dtv02,
     alias_c65dtv02,
@@ -411,6 +547,32 @@ static const uint32_t mnemonic_c65el02[] = {
     0x786261, 0x786365, 0x7a6561
 };
 
+static const uint8_t mnemonic_hash_c65el02[1 << MNEMONIC_HASH_BITS] = {
+    0, 0, 0, 0, 68, 0, 0, 36, 0, 119, 19, 0, 9, 63, 0, 0, 11, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 28, 0, 93, 0, 0, 128, 41, 0, 0, 0, 0, 26, 0, 0, 0, 118, 0, 0, 0,
+    0, 23, 73, 0, 0, 0, 0, 0, 51, 0, 0, 50, 0, 0, 0, 0, 62, 82, 0, 65, 0, 0, 0,
+    0, 0, 25, 0, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 0, 122, 0, 0, 0,
+    47, 27, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0, 126, 0, 0, 0, 0, 79, 0,
+    107, 0, 0, 0, 0, 113, 86, 0, 69, 0, 0, 0, 0, 0, 0, 81, 10, 0, 0, 0, 0, 78,
+    84, 0, 0, 0, 115, 0, 0, 0, 0, 0, 72, 0, 0, 0, 0, 0, 16, 85, 0, 0, 59, 0,
+    46, 0, 100, 0, 105, 90, 74, 0, 0, 15, 0, 92, 0, 0, 0, 0, 0, 0, 18, 0, 88,
+    0, 106, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 13, 0, 99, 0, 0, 89, 0, 129, 7, 0,
+    0, 0, 116, 58, 0, 0, 5, 0, 17, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 38, 0, 0, 0, 40, 0, 0, 77, 0,
+    0, 54, 0, 0, 0, 0, 0, 0, 117, 0, 0, 98, 0, 0, 0, 94, 0, 0, 112, 0, 0, 131,
+    0, 124, 0, 0, 0, 0, 0, 102, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 6, 0, 0, 0, 33, 0, 0, 0, 0, 0, 123, 0, 0, 0, 0, 120, 0, 0, 0, 0, 0, 0,
+    0, 24, 0, 12, 0, 0, 0, 0, 0, 0, 30, 0, 64, 0, 0, 0, 0, 130, 0, 57, 0, 71,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 121, 0, 0, 0, 39, 0, 0, 29, 80,
+    0, 110, 0, 0, 0, 0, 91, 0, 0, 70, 0, 127, 14, 0, 0, 61, 0, 44, 76, 0, 0, 0,
+    0, 0, 0, 0, 45, 0, 0, 0, 49, 0, 43, 0, 109, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 75, 0, 2, 0, 0, 42, 97, 0, 0, 0, 0, 0, 48, 37, 0, 0, 108,
+    0, 96, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 87, 0, 0, 95, 0, 53, 34, 0, 111,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 52, 0, 0, 0,
+    104, 0, 0, 0, 0, 0, 0, 0, 0, 101, 0, 0, 0, 0
+};
+
 static const uint16_t disasm_c65el02[] = {
     525, 2365, 316, 2621, 1398, 1341, 1282, 5949, 324, 573, 2, 339, 1142, 1085,
     1026, 1337, 4875, 3645, 3901, 2877, 1396, 2109, 2050, 5693, 272, 3133, 46,
@@ -448,6 +610,8 @@ static const uint8_t alias_c65el02[] = {
 const struct cpu_s c65el02 = {
     "65el02",
     mnemonic_c65el02,
+    mnemonic_hash_c65el02,
+    0xef8549d3,
     opcode_c65el02,
     disasm_c65el02,
     alias_c65el02,
@@ -485,6 +649,31 @@ static const uint32_t mnemonic_r65c02[] = {
     0x747378, 0x747861, 0x747873, 0x747961
 };
 
+static const uint8_t mnemonic_hash_r65c02[1 << MNEMONIC_HASH_BITS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 92, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0,
+    0, 0, 0, 37, 30, 0, 0, 0, 0, 80, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0, 0, 0, 0,
+    74, 35, 0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 58, 0, 0, 0, 34,
+    41, 0, 0, 0, 0, 0, 0, 0, 75, 12, 0, 0, 0, 0, 33, 0, 0, 0, 49, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 68, 63, 0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 32, 70, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 11, 0, 62, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0,
+    8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 50, 0, 0, 0, 0, 85, 0, 7, 15,
+    56, 0, 0, 0, 0, 90, 0, 0, 51, 0, 43, 0, 6, 0, 71, 0, 0, 57, 19, 0, 45, 0,
+    0, 0, 0, 42, 3, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 36, 0, 0, 0, 13, 0, 76,
+    0, 0, 82, 0, 20, 0, 0, 91, 73, 0, 0, 54, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 83, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 61, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 17, 0, 0, 0, 0, 0, 0, 28, 0, 10, 0, 0, 0, 0, 9, 0, 0, 0, 64, 46, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 24,
+    0, 0, 0, 88, 65, 47, 0, 52, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 21, 0, 0, 0, 0,
+    1, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 67, 48, 0, 0, 0, 0, 0, 5,
+    0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
 static const uint16_t disasm_r65c02[] = {
     527, 2359, 310, 310, 1367, 1335, 1282, 5443, 314, 567, 2, 310, 1111, 1079,
     1026, 5123, 4877, 3639, 3895, 310, 1366, 2103, 2050, 5443, 274, 3127, 44,
@@ -519,6 +708,8 @@ static const uint8_t alias_r65c02[] = {
 const struct cpu_s r65c02 = {
     "r65c02",
     mnemonic_r65c02,
+    mnemonic_hash_r65c02,
+    0x0f8a2771,
     opcode_r65c02,
     disasm_r65c02,
     alias_r65c02,
@@ -556,6 +747,31 @@ static const uint32_t mnemonic_w65c02[] = {
     0x747262, 0x747362, 0x747378, 0x747861, 0x747873, 0x747961, 0x776169
 };
 
+static const uint8_t mnemonic_hash_w65c02[1 << MNEMONIC_HASH_BITS] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+    0, 0, 0, 0, 95, 0, 94, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0,
+    0, 0, 0, 37, 30, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0,
+    75, 35, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 59, 0, 0, 0, 34,
+    41, 0, 0, 0, 0, 0, 0, 0, 76, 12, 0, 0, 0, 0, 33, 0, 0, 0, 50, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 69, 64, 0, 89, 0, 0, 44, 0, 0, 0, 0, 0, 0, 39, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 32, 71, 0, 0, 0, 0, 0, 0, 78, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 11, 0, 63, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+    0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80, 0, 51, 0, 0, 0, 0, 87, 0, 7,
+    15, 57, 0, 0, 0, 0, 92, 0, 0, 52, 0, 43, 0, 6, 0, 72, 0, 0, 58, 19, 0, 46,
+    0, 0, 0, 0, 42, 3, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 36, 0, 0, 0, 13, 0,
+    77, 0, 0, 84, 0, 20, 0, 0, 93, 74, 0, 0, 55, 0, 0, 0, 0, 67, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 85, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 62, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 28, 0, 10, 0, 0, 0, 0, 9, 0, 0, 0, 65, 47,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0,
+    24, 0, 0, 0, 90, 66, 48, 0, 53, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 21, 0, 0, 0,
+    0, 1, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 68, 49, 0, 0, 0, 0, 0,
+    5, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
 static const uint16_t disasm_w65c02[] = {
     527, 2360, 311, 311, 1369, 1336, 1282, 5444, 315, 568, 2, 311, 1113, 1080,
     1026, 5123, 4877, 3640, 3896, 311, 1368, 2104, 2050, 5444, 274, 3128, 45,
@@ -590,6 +806,8 @@ static const uint8_t alias_w65c02[] = {
 const struct cpu_s w65c02 = {
     "w65c02",
     mnemonic_w65c02,
+    mnemonic_hash_w65c02,
+    0x0f8a2771,
     opcode_w65c02,
     disasm_w65c02,
     alias_w65c02,
@@ -632,6 +850,32 @@ static const uint32_t mnemonic_c65ce02[] = {
     0x747861, 0x747873, 0x747961, 0x747973, 0x747a61
 };
 
+static const uint8_t mnemonic_hash_c65ce02[1 << MNEMONIC_HASH_BITS] = {
+    0, 0, 0, 6, 0, 0, 0, 108, 0, 0, 67, 7, 0, 0, 0, 0, 99, 22, 65, 0, 0, 0, 52,
+    0, 100, 0, 23, 0, 0, 63, 53, 15, 32, 101, 24, 0, 0, 0, 54, 0, 0, 0, 0, 0,
+    0, 0, 114, 55, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 81, 0, 56, 0, 0, 40,
+    25, 29, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 117, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 19, 0,
+    59, 0, 111, 0, 0, 0, 68, 75, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 116, 0, 0, 0, 89, 0, 57, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0, 26, 0, 96, 0, 0, 62, 0, 0,
+    0, 12, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 78, 86,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 79, 0, 0, 0, 27, 35, 0, 0, 0, 0, 0, 0,
+    0, 0, 36, 0, 48, 0, 0, 102, 0, 0, 37, 46, 41, 0, 0, 69, 0, 87, 0, 0, 0, 0,
+    0, 103, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
+    0, 0, 0, 0, 0, 0, 16, 0, 10, 0, 0, 0, 88, 94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 70, 0, 0, 0, 84, 0, 0, 0, 71, 38, 0, 0, 0, 0, 0, 0, 72, 0, 0,
+    0, 0, 107, 0, 0, 0, 73, 0, 0, 0, 0, 97, 42, 0, 2, 0, 95, 0, 0, 47, 0, 0, 0,
+    109, 0, 50, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 49,
+    0, 0, 0, 0, 0, 0, 0, 3, 11, 0, 66, 0, 0, 0, 0, 17, 1, 0, 28, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 104, 0, 0, 0, 0, 4, 0, 0, 105, 0, 0, 0, 43, 0, 90, 0, 44, 106,
+    0, 0, 0, 110, 39, 91, 0, 80, 0, 0, 0, 0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 18, 5, 0, 0, 0, 0, 0, 13, 0, 0, 98, 0, 14, 0, 0, 58, 0, 0,
+    8, 93, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 45, 0, 115, 0, 0, 74, 0,
+    0, 0, 64
+};
+
 static const uint16_t disasm_c65ce02[] = {
     529, 2369, 279, 347, 1389, 1345, 1282, 5457, 324, 577, 2, 367, 1133, 1089,
     1026, 5125, 4879, 3649, 6977, 4623, 1388, 2113, 2050, 5457, 277, 3137, 50,
@@ -668,6 +912,8 @@ static const uint8_t alias_c65ce02[] = {
 const struct cpu_s c65ce02 = {
     "65ce02",
     mnemonic_c65ce02,
+    mnemonic_hash_c65ce02,
+    0x04306245,
     opcode_c65ce02,
     disasm_c65ce02,
     alias_c65ce02,
@@ -711,6 +957,32 @@ static const uint32_t mnemonic_c4510[] = {
     0x747378, 0x747379, 0x747861, 0x747873, 0x747961, 0x747973, 0x747a61
 };
 
+static const uint8_t mnemonic_hash_c4510[1 << MNEMONIC_HASH_BITS] = {
+    0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 26, 0, 0, 75, 0, 0, 70,
+    0, 0, 0, 0, 0, 0, 106, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 10, 0, 0, 0, 0,
+    0, 0, 2, 0, 0, 0, 33, 0, 0, 65, 47, 25, 0, 79, 0, 0, 0, 0, 0, 0, 94, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 38, 0, 0, 74, 0, 57, 14, 0, 0, 0, 0, 0, 0, 0, 83, 0, 112, 0, 0,
+    0, 69, 0, 0, 0, 0, 0, 111, 119, 0, 0, 41, 0, 0, 0, 0, 0, 105, 117, 0, 0, 0,
+    0, 46, 0, 78, 0, 0, 115, 0, 0, 0, 93, 0, 0, 0, 0, 88, 0, 0, 0, 0, 31, 0, 0,
+    28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 66,
+    0, 8, 0, 0, 0, 52, 0, 0, 118, 0, 0, 17, 0, 0, 39, 0, 0, 0, 116, 0, 0, 0, 0,
+    0, 0, 0, 43, 0, 0, 37, 21, 0, 32, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 92,
+    98, 1, 0, 0, 13, 0, 0, 103, 0, 30, 99, 0, 0, 0, 0, 0, 0, 0, 0, 95, 0, 0, 0,
+    0, 89, 0, 0, 0, 0, 0, 91, 0, 0, 72, 0, 12, 0, 0, 0, 0, 42, 0, 0, 114, 0,
+    64, 0, 0, 0, 0, 0, 0, 0, 0, 63, 77, 84, 59, 0, 0, 0, 0, 0, 0, 0, 36, 104,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 0,
+    29, 0, 0, 0, 71, 0, 19, 0, 0, 0, 0, 45, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 110, 0, 0, 0, 56, 0, 0, 51, 113, 90, 81, 0, 0, 0, 0, 0, 3, 0, 0,
+    62, 67, 109, 0, 0, 0, 0, 0, 0, 108, 0, 35, 0, 0, 0, 0, 100, 4, 24, 0, 0,
+    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 101, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 40, 0, 0, 7, 0, 15, 0, 0, 0, 0, 48, 0, 0, 60, 0, 0, 0, 0, 55,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 61, 0, 0, 0, 0, 0, 0, 0, 0, 107,
+    0, 34, 0, 0, 0, 0, 44, 0, 23, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 96, 5, 68, 0, 80, 86, 0, 76, 11, 0, 0, 0, 27, 0, 0, 0, 6, 0, 0, 20,
+    97, 0, 0, 0, 0, 0
+};
+
 static const uint16_t disasm_c4510[] = {
     529, 2371, 279, 349, 1391, 1347, 1282, 5459, 326, 579, 2, 369, 1135, 1091,
     1026, 5125, 4879, 3651, 6979, 4623, 1390, 2115, 2050, 5459, 277, 3139, 51,
@@ -747,6 +1019,8 @@ static const uint8_t alias_c4510[] = {
 const struct cpu_s c4510 = {
     "4510",
     mnemonic_c4510,
+    mnemonic_hash_c4510,
+    0xd6fae3cd,
     opcode_c4510,
     disasm_c4510,
     alias_c4510,
@@ -794,6 +1068,32 @@ static const uint32_t mnemonic_c45gs02[] = {
     0x747a61
 };
 
+static const uint8_t mnemonic_hash_c45gs02[1 << MNEMONIC_HASH_BITS] = {
+    0, 0, 0, 10, 0, 0, 0, 0, 71, 60, 0, 0, 0, 0, 0, 122, 0, 0, 19, 31, 87, 46,
+    0, 0, 0, 0, 119, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 49, 0, 0, 0,
+    0, 0, 0, 132, 35, 0, 94, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 5,
+    0, 4, 0, 127, 52, 0, 0, 0, 0, 0, 117, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    41, 22, 0, 74, 76, 105, 0, 0, 0, 0, 0, 34, 0, 16, 0, 0, 111, 0, 0, 0, 0, 0,
+    0, 80, 0, 0, 0, 57, 0, 0, 0, 0, 0, 0, 113, 137, 0, 65, 0, 0, 0, 0, 0, 0,
+    125, 0, 0, 0, 0, 0, 11, 0, 99, 0, 0, 0, 72, 0, 58, 112, 0, 0, 0, 0, 0, 8,
+    0, 0, 88, 0, 0, 0, 12, 120, 108, 90, 0, 0, 0, 0, 0, 0, 0, 2, 17, 0, 44, 0,
+    0, 0, 63, 0, 0, 0, 0, 0, 134, 36, 0, 0, 0, 101, 0, 15, 0, 39, 0, 0, 91, 0,
+    0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 118, 0, 0, 29, 115, 0, 0,
+    0, 0, 97, 0, 0, 0, 81, 0, 56, 75, 23, 0, 0, 0, 0, 0, 21, 0, 0, 0, 0, 0,
+    129, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 6, 0, 30, 0, 0, 0, 66, 0,
+    0, 107, 25, 0, 126, 0, 0, 0, 0, 106, 0, 1, 0, 0, 0, 0, 92, 61, 0, 0, 24, 0,
+    0, 0, 123, 0, 0, 0, 0, 89, 0, 0, 0, 98, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 45, 0, 0, 0, 0, 0, 59, 0, 0, 51, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 40, 13,
+    0, 9, 0, 0, 109, 0, 0, 0, 69, 0, 7, 70, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 103, 96, 0, 0, 0, 102, 0, 0, 0, 0, 0, 18, 0, 136,
+    0, 100, 0, 0, 0, 0, 78, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 32,
+    0, 67, 0, 55, 0, 0, 42, 0, 84, 0, 0, 0, 0, 116, 0, 0, 131, 0, 0, 93, 62,
+    104, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 130, 33, 26, 135, 114, 85,
+    14, 0, 95, 0, 0, 0, 0, 27, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 77, 64, 0, 0, 0, 79, 0, 124, 0, 0, 0
+};
+
 static const uint16_t disasm_c45gs02[] = {
     533, 2384, 284, 366, 1409, 1360, 1286, 5474, 340, 592, 6, 387, 1153, 1104,
     1030, 5129, 4883, 3664, 6992, 4627, 1408, 2128, 2054, 5474, 282, 3152, 60,
@@ -831,6 +1131,8 @@ static const uint8_t alias_c45gs02[] = {
 const struct cpu_s c45gs02 = {
     "45gs02",
     mnemonic_c45gs02,
+    mnemonic_hash_c45gs02,
+    0x456126f9,
     opcode_c45gs02,
     disasm_c45gs02,
     alias_c45gs02,
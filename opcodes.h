@@ -21,6 +21,7 @@
 #include "inttypes.h"
 
 #define ____ 0x69
+#define MNEMONIC_HASH_BITS 9
 
 typedef enum Adr_types {
     ADR_REG, ADR_IMPLIED, ADR_IMMEDIATE, ADR_LONG, ADR_ADDR, ADR_ZP, ADR_LONG_X,
@@ -48,6 +49,8 @@ typedef enum Reg_types {
 struct cpu_s {
     const char *name;
     const uint32_t *mnemonic;
+    const uint8_t *mnemonic_hash;
+    uint32_t mnemonic_mul;
     const uint16_t *opcode;
     const uint16_t *disasm;
     const uint8_t *alias;
@@ -0,0 +1,138 @@
+/*
+    $Id$
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+*/
+#include "passtrace.h"
+#include <stdio.h>
+#include <errno.h>
+#include "file.h"
+#include "error.h"
+#include "unicode.h"
+#include "values.h"
+#include "arguments.h"
+#include "obj.h"
+#include "strobj.h"
+#include "typeobj.h"
+#include "64tass.h"
+#include "str.h"
+
+bool pass_tracing = false;
+
+static struct {
+    FILE *f;
+    int err;
+    size_t changes, total;
+} trace;
+
+void pass_trace_init(const struct pass_trace_s *output) {
+    if (output->name == NULL) return;
+    pass_tracing = true;
+    trace.changes = trace.total = 0;
+    trace.f = dash_name(output->name) ? stdout : fopen_utf8(output->name, "wt");
+    if (trace.f == NULL) {
+        trace.err = errno;
+        return;
+    }
+    if (trace.f == stdout && fflush(trace.f) != 0) setvbuf(trace.f, NULL, _IOLBF, 1024);
+    clearerr(trace.f); errno = 0;
+}
+
+static void pass_trace_position(const str_t *name, const struct file_list_s *flist, linepos_t epoint) {
+    printable_print((const uint8_t *)((flist->file->name[0] == '\0') ? "<other>" : flist->file->name), trace.f);
+    fprintf(trace.f, ":%" PRIuline ":%" PRIlinepos ": pass %u: ", epoint->line, epoint->pos + 1, (unsigned int)pass);
+    if (name == NULL || name->len == 0) return;
+    putc('\'', trace.f);
+    if (name->data[0] == '-' || name->data[0] == '+') {
+        putc(name->data[0], trace.f);
+    } else if (name->data[0] == '.' || name->data[0] == '#') {
+        fputs("<anonymous>", trace.f);
+    } else fwrite(name->data, 1, name->len, trace.f);
+    fputs("' ", trace.f);
+}
+
+static void pass_trace_print(Obj *val) {
+    Obj *str = val->obj->repr(val, NULL, 64);
+    if (str != NULL && str->obj == STR_OBJ) {
+        fwrite(Str(str)->data, 1, Str(str)->len, trace.f);
+    } else {
+        fprintf(trace.f, "<%s>", val->obj->name);
+    }
+    if (str != NULL) val_destroy(str);
+}
+
+void pass_trace_value(const str_t *name, linepos_t epoint, Obj *old, Obj *val) {
+    trace.changes++;
+    if (trace.f == NULL) return;
+    pass_trace_position(name, current_file_list, epoint);
+    fputs("changed from ", trace.f);
+    pass_trace_print(old);
+    fputs(" to ", trace.f);
+    pass_trace_print(val);
+    putc('\n', trace.f);
+}
+
+void pass_trace_address(const str_t *name, linepos_t epoint, const char *what, uval_t old, uval_t val) {
+    trace.changes++;
+    if (trace.f == NULL) return;
+    pass_trace_position(name, current_file_list, epoint);
+    fprintf(trace.f, "%s changed from $%" PRIxval " to $%" PRIxval "\n", what, old, val);
+}
+
+void pass_trace_address2(const str_t *name, const struct file_list_s *flist, linepos_t epoint, const char *what, uval_t old, uval_t val) {
+    trace.changes++;
+    if (trace.f == NULL) return;
+    pass_trace_position(name, flist, epoint);
+    fprintf(trace.f, "%s changed from $%" PRIxval " to $%" PRIxval "\n", what, old, val);
+}
+
+void pass_trace_note(const str_t *name, linepos_t epoint, const char *what) {
+    trace.changes++;
+    if (trace.f == NULL) return;
+    pass_trace_position(name, current_file_list, epoint);
+    fputs(what, trace.f);
+    putc('\n', trace.f);
+}
+
+void pass_trace_end(size_t forward) {
+    if (trace.f != NULL) {
+        fprintf(trace.f, "pass %u: %" PRIuSIZE " changes, %" PRIuSIZE " unresolved forward references\n", (unsigned int)pass, trace.changes, forward);
+    }
+    trace.total += trace.changes;
+    trace.changes = 0;
+}
+
+void pass_trace_close(const struct pass_trace_s *output) {
+    int err;
+    if (!pass_tracing) return;
+    pass_tracing = false;
+    if (trace.f == NULL) {
+        errno = trace.err;
+        err_msg_file2(ERROR_CANT_WRTE_TRC, output->name, &output->name_pos);
+        return;
+    }
+    fprintf(trace.f, "total: %" PRIuSIZE " changes\n", trace.total);
+    err = ferror(trace.f);
+    err |= (trace.f != stdout) ? fclose(trace.f) : fflush(trace.f);
+    trace.f = NULL;
+    if (err != 0 && errno != 0) err_msg_file2(ERROR_CANT_WRTE_TRC, output->name, &output->name_pos);
+}
+
+void pass_trace_destroy(void) {
+    if (trace.f != NULL && trace.f != stdout) fclose(trace.f);
+    trace.f = NULL;
+    pass_tracing = false;
+}
@@ -0,0 +1,39 @@
+/*
+    $Id$
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+*/
+#ifndef PASSTRACE_H
+#define PASSTRACE_H
+#include "stdbool.h"
+#include "inttypes.h"
+
+struct pass_trace_s;
+struct str_t;
+struct Obj;
+struct file_list_s;
+
+extern bool pass_tracing;
+extern void pass_trace_init(const struct pass_trace_s *);
+extern void pass_trace_value(const struct str_t *, linepos_t, struct Obj *, struct Obj *);
+extern void pass_trace_address(const struct str_t *, linepos_t, const char *, uval_t, uval_t);
+extern void pass_trace_address2(const struct str_t *, const struct file_list_s *, linepos_t, const char *, uval_t, uval_t);
+extern void pass_trace_note(const struct str_t *, linepos_t, const char *);
+extern void pass_trace_end(size_t);
+extern void pass_trace_close(const struct pass_trace_s *);
+extern void pass_trace_destroy(void);
+
+#endif
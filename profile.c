@@ -0,0 +1,446 @@
+/*
+    $Id$
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+*/
+#include "profile.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#if defined _POSIX_C_SOURCE || defined __unix__
+#include <unistd.h>
+#endif
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+#include "file.h"
+#include "error.h"
+#include "unicode.h"
+#include "values.h"
+#include "arguments.h"
+#include "version.h"
+
+bool profiling = false;
+
+struct profile_count_s {
+    uint64_t time;
+    size_t allocs;
+};
+
+struct profile_pass_s {
+    struct profile_count_s phase[PROFILE_PHASES];
+};
+
+struct profile_file_s {
+    const struct file_s *file;
+    struct profile_count_s count;
+};
+
+struct profile_macro_s {
+    const struct file_s *file;
+    linenum_t line;
+    size_t calls;
+    struct profile_count_s count;
+};
+
+struct profile_frame_s {
+    size_t macro;
+    struct profile_count_s start;
+};
+
+static struct profile_count_s last;
+static unsigned int current_pass;
+static uint16_t current_file;
+
+static struct {
+    size_t len;
+    struct profile_pass_s *data;
+} passes;
+
+static struct {
+    size_t p, len;
+    Profile_phases *data;
+} phases;
+
+static struct {
+    size_t len;
+    struct profile_file_s *data;
+} files;
+
+static struct {
+    size_t p, len, mask;
+    struct profile_macro_s *data;
+    size_t *hash;
+} macros;
+
+static struct {
+    size_t p, len;
+    struct profile_frame_s *data;
+} frames;
+
+static const char *const phase_names[PROFILE_PHASES] = {
+    "parse", "eval", "instruction", "optimize", "listing", "output"
+};
+
+#if defined _POSIX_TIMERS && _POSIX_TIMERS > 0 && defined CLOCK_MONOTONIC
+static uint64_t profile_clock(void) {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) return 0;
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+#elif defined _WIN32
+static uint64_t profile_clock(void) {
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER count;
+    if (freq.QuadPart == 0 && !QueryPerformanceFrequency(&freq)) return 0;
+    if (!QueryPerformanceCounter(&count)) return 0;
+    return (uint64_t)count.QuadPart / (uint64_t)freq.QuadPart * 1000000000
+        + (uint64_t)count.QuadPart % (uint64_t)freq.QuadPart * 1000000000 / (uint64_t)freq.QuadPart;
+}
+#else
+static uint64_t profile_clock(void) {
+    return (uint64_t)clock() * 1000000000 / CLOCKS_PER_SEC;
+}
+#endif
+
+static void profile_add(struct profile_count_s *c, const struct profile_count_s *d) {
+    c->time += d->time;
+    c->allocs += d->allocs;
+}
+
+/* Charge the time and allocations since the last event to the current
+   pass, phase and file. */
+static void profile_charge(void) {
+    struct profile_count_s d, now;
+    now.time = profile_clock();
+    now.allocs = val_allocs;
+    d.time = now.time - last.time;
+    d.allocs = now.allocs - last.allocs;
+    last = now;
+    profile_add(&passes.data[current_pass].phase[phases.data[phases.p - 1]], &d);
+    profile_add(&files.data[current_file].count, &d);
+}
+
+static void profile_reset_stack(void) {
+    phases.p = 1;
+    phases.data[0] = PROFILE_PARSE;
+    frames.p = 0;
+}
+
+void profile_init(const struct profile_output_s *output) {
+    if (output->name == NULL || profiling) return;
+    profiling = true;
+    new_array(&passes.data, 1);
+    memset(passes.data, 0, sizeof *passes.data);
+    passes.len = 1;
+    phases.len = 16;
+    new_array(&phases.data, phases.len);
+    new_array(&files.data, 1);
+    memset(files.data, 0, sizeof *files.data);
+    files.len = 1;
+    current_pass = 0;
+    current_file = 0;
+    profile_reset_stack();
+    last.time = profile_clock();
+    last.allocs = val_allocs;
+}
+
+void profile_pass(unsigned int p) {
+    if (!profiling) return;
+    profile_charge();
+    if (p >= passes.len) {
+        size_t i = passes.len;
+        if (add_overflow(p, 1, &passes.len)) err_msg_out_of_memory();
+        resize_array(&passes.data, passes.len);
+        memset(passes.data + i, 0, (passes.len - i) * sizeof *passes.data);
+    }
+    current_pass = p;
+    current_file = 0;
+    profile_reset_stack();
+}
+
+void profile_enter2(Profile_phases phase) {
+    profile_charge();
+    if (phases.p >= phases.len) extend_array(&phases.data, &phases.len, 16);
+    phases.data[phases.p++] = phase;
+}
+
+void profile_leave2(void) {
+    profile_charge();
+    if (phases.p > 1) phases.p--;
+}
+
+void profile_file2(const struct file_s *file) {
+    profile_charge();
+    if (file->uid >= files.len) {
+        size_t i = files.len;
+        files.len = (size_t)file->uid + 1;
+        resize_array(&files.data, files.len);
+        memset(files.data + i, 0, (files.len - i) * sizeof *files.data);
+    }
+    current_file = file->uid;
+    files.data[current_file].file = file;
+}
+
+static size_t profile_macro_hash(const struct file_s *file, linenum_t line) {
+    return (size_t)file->uid * 0x9e3779b1U + line;
+}
+
+static size_t profile_macro_find(const struct file_s *file, linenum_t line) {
+    size_t offs, hash = profile_macro_hash(file, line);
+    struct profile_macro_s *m;
+    if (macros.hash != NULL) {
+        offs = hash & macros.mask;
+        while (macros.hash[offs] != SIZE_MAX) {
+            m = &macros.data[macros.hash[offs]];
+            if (m->file == file && m->line == line) return macros.hash[offs];
+            hash >>= 5;
+            offs = (5 * offs + hash + 1) & macros.mask;
+        }
+    }
+    if (macros.p >= macros.len) extend_array(&macros.data, &macros.len, 16);
+    m = &macros.data[macros.p];
+    m->file = file;
+    m->line = line;
+    m->calls = 0;
+    m->count.time = 0;
+    m->count.allocs = 0;
+    if (macros.p * 3 / 2 >= macros.mask) {
+        size_t i;
+        macros.mask = macros.mask * 2 + 1;
+        if (macros.mask < 15) macros.mask = 15;
+        free(macros.hash);
+        new_array(&macros.hash, macros.mask + 1);
+        for (i = 0; i <= macros.mask; i++) macros.hash[i] = SIZE_MAX;
+        for (i = 0; i <= macros.p; i++) {
+            hash = profile_macro_hash(macros.data[i].file, macros.data[i].line);
+            offs = hash & macros.mask;
+            while (macros.hash[offs] != SIZE_MAX) {
+                hash >>= 5;
+                offs = (5 * offs + hash + 1) & macros.mask;
+            }
+            macros.hash[offs] = i;
+        }
+    } else {
+        hash = profile_macro_hash(file, line);
+        offs = hash & macros.mask;
+        while (macros.hash[offs] != SIZE_MAX) {
+            hash >>= 5;
+            offs = (5 * offs + hash + 1) & macros.mask;
+        }
+        macros.hash[offs] = macros.p;
+    }
+    return macros.p++;
+}
+
+void profile_macro_enter2(const struct file_s *file, linenum_t line) {
+    struct profile_frame_s *frame;
+    profile_charge();
+    if (frames.p >= frames.len) extend_array(&frames.data, &frames.len, 16);
+    frame = &frames.data[frames.p++];
+    frame->macro = profile_macro_find(file, line);
+    frame->start = last;
+    macros.data[frame->macro].calls++;
+}
+
+void profile_macro_leave2(void) {
+    const struct profile_frame_s *frame;
+    struct profile_macro_s *m;
+    profile_charge();
+    if (frames.p == 0) return;
+    frame = &frames.data[--frames.p];
+    m = &macros.data[frame->macro];
+    m->count.time += last.time - frame->start.time;
+    m->count.allocs += last.allocs - frame->start.allocs;
+}
+
+static double profile_seconds(uint64_t time) {
+    return (double)time / 1e9;
+}
+
+static int profile_file_compare(const void *a, const void *b) {
+    const struct profile_file_s *aa = *(const struct profile_file_s **)a;
+    const struct profile_file_s *bb = *(const struct profile_file_s **)b;
+    if (aa->count.time != bb->count.time) return (aa->count.time < bb->count.time) ? 1 : -1;
+    return (aa->file->uid > bb->file->uid) ? 1 : -1;
+}
+
+static int profile_macro_compare(const void *a, const void *b) {
+    const struct profile_macro_s *aa = *(const struct profile_macro_s **)a;
+    const struct profile_macro_s *bb = *(const struct profile_macro_s **)b;
+    if (aa->count.time != bb->count.time) return (aa->count.time < bb->count.time) ? 1 : -1;
+    if (aa->file->uid != bb->file->uid) return (aa->file->uid > bb->file->uid) ? 1 : -1;
+    if (aa->line != bb->line) return (aa->line > bb->line) ? 1 : -1;
+    return 0;
+}
+
+static const char *profile_file_name(const struct file_s *file) {
+    return (file->name[0] == '\0') ? "<other>" : file->name;
+}
+
+static void profile_name_print(const struct file_s *file, FILE *f) {
+    if (file->name[0] == '\0') fputs("<other>", f);
+    else if (file->notfile) fputs(file->name, f);
+    else argv_print(file->name, f);
+}
+
+static void json_string(const char *s, FILE *f) {
+    putc('"', f);
+    for (; *s != '\0'; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            putc('\\', f);
+            putc(c, f);
+        } else if (c < 0x20) {
+            fprintf(f, "\\u%04x", c);
+        } else putc(c, f);
+    }
+    putc('"', f);
+}
+
+static void profile_pass_total(const struct profile_pass_s *p, struct profile_count_s *total) {
+    unsigned int i;
+    total->time = 0;
+    total->allocs = 0;
+    for (i = 0; i < PROFILE_PHASES; i++) profile_add(total, &p->phase[i]);
+}
+
+static void profile_text(FILE *f, const struct profile_file_s **fl, size_t fn, const struct profile_macro_s **ml) {
+    struct profile_count_s total, sum;
+    size_t i;
+    unsigned int j;
+
+    fputs("\n64tass Turbo Assembler Macro V" VERSION " profile\n\nPass  ", f);
+    for (j = 0; j < PROFILE_PHASES; j++) fprintf(f, " %11s", phase_names[j]);
+    fputs("       total     allocs\n", f);
+    sum.time = 0;
+    sum.allocs = 0;
+    for (i = 0; i < passes.len; i++) {
+        const struct profile_pass_s *p = &passes.data[(i + 1) % passes.len];
+        if (i + 1 == passes.len) fputs("other ", f); else fprintf(f, "%-6" PRIuSIZE, i + 1);
+        for (j = 0; j < PROFILE_PHASES; j++) fprintf(f, " %11.6f", profile_seconds(p->phase[j].time));
+        profile_pass_total(p, &total);
+        profile_add(&sum, &total);
+        fprintf(f, " %11.6f %10" PRIuSIZE "\n", profile_seconds(total.time), total.allocs);
+    }
+    fprintf(f, "total %*s %11.6f %10" PRIuSIZE "\n", 12 * PROFILE_PHASES - 1, "", profile_seconds(sum.time), sum.allocs);
+
+    fputs("\n       time     allocs  File\n", f);
+    for (i = 0; i < fn; i++) {
+        fprintf(f, "%11.6f %10" PRIuSIZE "  ", profile_seconds(fl[i]->count.time), fl[i]->count.allocs);
+        profile_name_print(fl[i]->file, f);
+        putc('\n', f);
+    }
+
+    if (macros.p == 0) return;
+    fputs("\n       time     allocs      calls  Macro or function\n", f);
+    for (i = 0; i < macros.p; i++) {
+        fprintf(f, "%11.6f %10" PRIuSIZE " %10" PRIuSIZE "  ", profile_seconds(ml[i]->count.time), ml[i]->count.allocs, ml[i]->calls);
+        profile_name_print(ml[i]->file, f);
+        fprintf(f, ":%" PRIuline "\n", ml[i]->line);
+    }
+}
+
+static void profile_json(FILE *f, const struct profile_file_s **fl, size_t fn, const struct profile_macro_s **ml) {
+    struct profile_count_s total;
+    size_t i;
+    unsigned int j;
+
+    fputs("{\n  \"version\": \"" VERSION "\",\n  \"passes\": [", f);
+    for (i = 0; i < passes.len; i++) {
+        const struct profile_pass_s *p = &passes.data[(i + 1) % passes.len];
+        profile_pass_total(p, &total);
+        fputs(i != 0 ? ",\n    {" : "\n    {", f);
+        if (i + 1 == passes.len) fputs("\"pass\": null", f); else fprintf(f, "\"pass\": %" PRIuSIZE, i + 1);
+        fprintf(f, ", \"time\": %.9f, \"allocs\": %" PRIuSIZE ", \"phases\": {", profile_seconds(total.time), total.allocs);
+        for (j = 0; j < PROFILE_PHASES; j++) {
+            fprintf(f, "%s\"%s\": {\"time\": %.9f, \"allocs\": %" PRIuSIZE "}", j != 0 ? ", " : "", phase_names[j], profile_seconds(p->phase[j].time), p->phase[j].allocs);
+        }
+        fputs("}}", f);
+    }
+    fputs("\n  ],\n  \"files\": [", f);
+    for (i = 0; i < fn; i++) {
+        fputs(i != 0 ? ",\n    {\"name\": " : "\n    {\"name\": ", f);
+        json_string(profile_file_name(fl[i]->file), f);
+        fprintf(f, ", \"time\": %.9f, \"allocs\": %" PRIuSIZE "}", profile_seconds(fl[i]->count.time), fl[i]->count.allocs);
+    }
+    fputs("\n  ],\n  \"macros\": [", f);
+    for (i = 0; i < macros.p; i++) {
+        fputs(i != 0 ? ",\n    {\"file\": " : "\n    {\"file\": ", f);
+        json_string(ml[i]->file->name, f);
+        fprintf(f, ", \"line\": %" PRIuline ", \"calls\": %" PRIuSIZE ", \"time\": %.9f, \"allocs\": %" PRIuSIZE "}", ml[i]->line, ml[i]->calls, profile_seconds(ml[i]->count.time), ml[i]->count.allocs);
+    }
+    fputs("\n  ]\n}\n", f);
+}
+
+void profile_print(const struct profile_output_s *output) {
+    const struct profile_file_s **fl;
+    const struct profile_macro_s **ml;
+    size_t i, fn;
+    FILE *f;
+    int err;
+
+    if (!profiling) return;
+    profile_charge();
+
+    new_array(&fl, files.len);
+    for (fn = i = 0; i < files.len; i++) {
+        if (files.data[i].file != NULL) fl[fn++] = &files.data[i];
+    }
+    qsort(fl, fn, sizeof *fl, profile_file_compare);
+    new_array(&ml, macros.p + 1);
+    for (i = 0; i < macros.p; i++) ml[i] = &macros.data[i];
+    qsort(ml, macros.p, sizeof *ml, profile_macro_compare);
+
+    f = dash_name(output->name) ? stdout : fopen_utf8(output->name, "wt");
+    if (f == NULL) {
+        err_msg_file2(ERROR_CANT_WRTE_PRF, output->name, &output->name_pos);
+    } else {
+        if (f == stdout && fflush(f) != 0) setvbuf(f, NULL, _IOLBF, 1024);
+        clearerr(f); errno = 0;
+        if (output->json) profile_json(f, fl, fn, ml); else profile_text(f, fl, fn, ml);
+        err = ferror(f);
+        err |= (f != stdout) ? fclose(f) : fflush(f);
+        if (err != 0 && errno != 0) err_msg_file2(ERROR_CANT_WRTE_PRF, output->name, &output->name_pos);
+    }
+    free(ml);
+    free(fl);
+    last.time = profile_clock(); /* writing is not charged */
+    last.allocs = val_allocs;
+}
+
+void profile_destroy(void) {
+    free(passes.data);
+    free(phases.data);
+    free(files.data);
+    free(macros.data);
+    free(macros.hash);
+    free(frames.data);
+    passes.data = NULL;
+    passes.len = 0;
+    phases.data = NULL;
+    phases.p = phases.len = 0;
+    files.data = NULL;
+    files.len = 0;
+    macros.data = NULL;
+    macros.hash = NULL;
+    macros.p = macros.len = macros.mask = 0;
+    frames.data = NULL;
+    frames.p = frames.len = 0;
+    profiling = false;
+}
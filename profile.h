@@ -0,0 +1,63 @@
+/*
+    $Id$
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+*/
+#ifndef PROFILE_H
+#define PROFILE_H
+#include "stdbool.h"
+#include "inttypes.h"
+
+typedef enum Profile_phases {
+    PROFILE_PARSE, PROFILE_EVAL, PROFILE_INSTRUCTION, PROFILE_OPTIMIZE,
+    PROFILE_LISTING, PROFILE_OUTPUT, PROFILE_PHASES
+} Profile_phases;
+
+struct file_s;
+struct profile_output_s;
+
+extern bool profiling;
+extern void profile_init(const struct profile_output_s *);
+extern void profile_pass(unsigned int);
+extern void profile_enter2(Profile_phases);
+extern void profile_leave2(void);
+extern void profile_file2(const struct file_s *);
+extern void profile_macro_enter2(const struct file_s *, linenum_t);
+extern void profile_macro_leave2(void);
+extern void profile_print(const struct profile_output_s *);
+extern void profile_destroy(void);
+
+static inline void profile_enter(Profile_phases phase) {
+    if (profiling) profile_enter2(phase);
+}
+
+static inline void profile_leave(void) {
+    if (profiling) profile_leave2();
+}
+
+static inline void profile_file(const struct file_s *file) {
+    if (profiling) profile_file2(file);
+}
+
+static inline void profile_macro_enter(const struct file_s *file, linenum_t line) {
+    if (profiling) profile_macro_enter2(file, line);
+}
+
+static inline void profile_macro_leave(void) {
+    if (profiling) profile_macro_leave2();
+}
+
+#endif
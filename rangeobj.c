@@ -0,0 +1,301 @@
+/*
+    $Id$
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+*/
+#include "rangeobj.h"
+#include "eval.h"
+#include "values.h"
+#include "error.h"
+
+#include "boolobj.h"
+#include "intobj.h"
+#include "listobj.h"
+#include "typeobj.h"
+#include "errorobj.h"
+
+static Type obj;
+
+Type *const RANGE_OBJ = &obj;
+
+MUST_CHECK Obj *new_range(ival_t start, ival_t step, uval_t len) {
+    Range *v = Range(val_alloc(RANGE_OBJ));
+    if (len < 2) {
+        if (len == 0) start = 0;
+        step = 1;
+    }
+    v->start = start;
+    v->step = step;
+    v->len = len;
+    return Obj(v);
+}
+
+MUST_CHECK Obj *list_from_range(const Range *v1) {
+    List *v;
+    Obj **vals;
+    uval_t i;
+    if (v1->len == 0) return val_reference(null_list);
+    v = new_list();
+    vals = list_create_elements(v, v1->len);
+    for (i = 0; i < v1->len; i++) {
+        vals[i] = int_from_ival(range_element(v1, i));
+    }
+    v->len = v1->len;
+    v->data = vals;
+    return Obj(v);
+}
+
+/* Maps every element x to x * mul + add, if the result still fits */
+static MUST_CHECK Obj *linear(Range *v1, int64_t mul, int64_t add) {
+    int64_t start, last, step;
+    if (v1->len == 0) return val_reference(Obj(v1));
+    start = (int64_t)v1->start * mul + add;
+    last = (int64_t)range_element(v1, v1->len - 1) * mul + add;
+    step = (int64_t)v1->step * mul;
+    if (start < INT32_MIN || start > INT32_MAX || last < INT32_MIN || last > INT32_MAX) return NULL;
+    if (step < INT32_MIN || step > INT32_MAX) return NULL;
+    return new_range((ival_t)start, (ival_t)step, v1->len);
+}
+
+static FAST_CALL bool same(const Obj *o1, const Obj *o2) {
+    const Range *v1 = Range(o1), *v2 = Range(o2);
+    return o1->obj == o2->obj && v1->start == v2->start && v1->step == v2->step && v1->len == v2->len;
+}
+
+static MUST_CHECK Obj *hash(Obj *o1, int *hs, linepos_t UNUSED(epoint)) {
+    const Range *v1 = Range(o1);
+    unsigned int h, a = v1->len, b = (v1->len != 0) ? v1->len - 1 : 0;
+    /* same as the list of the elements */
+    if ((a & 1) == 0) a /= 2; else b /= 2;
+    h = (unsigned int)v1->len * (unsigned int)v1->start + a * b * (unsigned int)v1->step;
+    h ^= (unsigned int)v1->len;
+    *hs = (int)(h & ((~0U) >> 1));
+    return NULL;
+}
+
+static MUST_CHECK Obj *repr(Obj *o1, linepos_t epoint, size_t maxsize) {
+    Obj *list, *v;
+    if (Range(o1)->len > maxsize / 2) return NULL;
+    list = list_from_range(Range(o1));
+    v = list->obj->repr(list, epoint, maxsize);
+    val_destroy(list);
+    return v;
+}
+
+static MUST_CHECK Obj *len(oper_t op) {
+    return int_from_uval(Range(op->v2)->len);
+}
+
+static FAST_CALL MUST_CHECK Obj *iter_element(struct iter_s *v1, size_t i) {
+    if (v1->iter != NULL) val_destroy(v1->iter);
+    v1->iter = int_from_ival(range_element(Range(v1->data), (uval_t)i));
+    return v1->iter;
+}
+
+static FAST_CALL MUST_CHECK Obj *iter_forward(struct iter_s *v1) {
+    if (v1->val >= v1->len) return NULL;
+    return iter_element(v1, v1->val++);
+}
+
+static void getiter(struct iter_s *v) {
+    v->iter = NULL;
+    v->val = 0;
+    v->data = val_reference(v->data);
+    v->next = iter_forward;
+    v->len = Range(v->data)->len;
+}
+
+static FAST_CALL MUST_CHECK Obj *iter_reverse(struct iter_s *v1) {
+    if (v1->val >= v1->len) return NULL;
+    return iter_element(v1, v1->len - ++v1->val);
+}
+
+static void getriter(struct iter_s *v) {
+    v->iter = NULL;
+    v->val = 0;
+    v->data = val_reference(v->data);
+    v->next = iter_reverse;
+    v->len = Range(v->data)->len;
+}
+
+static MUST_CHECK Obj *calc1(oper_t op) {
+    Range *v1 = Range(op->v1);
+    Obj *v, *list;
+    switch (op->op) {
+    case O_POS: return val_reference(op->v1);
+    case O_NEG: v = linear(v1, -1, 0); break;
+    case O_INV: v = linear(v1, -1, -1); break;
+    default: v = NULL; break;
+    }
+    if (v != NULL) return v;
+    list = list_from_range(v1);
+    op->v1 = list;
+    op->inplace = (list->refcount == 1) ? list : NULL;
+    v = list->obj->calc1(op);
+    val_destroy(list);
+    return v;
+}
+
+static MUST_CHECK Obj *calc2_int(oper_t op, Range *v1, Obj *o2, bool rev) {
+    ival_t iv;
+    Error *err;
+    switch (op->op) {
+    case O_ADD:
+    case O_SUB:
+    case O_MUL:
+        break;
+    default:
+        return NULL;
+    }
+    err = o2->obj->ival(o2, &iv, 8 * sizeof iv, op->epoint3);
+    if (err != NULL) {
+        val_destroy(Obj(err));
+        return NULL;
+    }
+    switch (op->op) {
+    case O_ADD: return linear(v1, 1, iv);
+    case O_SUB: return rev ? linear(v1, -1, iv) : linear(v1, 1, -(int64_t)iv);
+    default: return (iv != 0) ? linear(v1, iv, 0) : NULL;
+    }
+}
+
+static MUST_CHECK Obj *calc2(oper_t op) {
+    Obj *v, *list;
+    if (op->v2->obj == INT_OBJ) {
+        v = calc2_int(op, Range(op->v1), op->v2, false);
+        if (v != NULL) return v;
+    }
+    list = list_from_range(Range(op->v1));
+    op->v1 = list;
+    op->inplace = (list->refcount == 1) ? list : NULL;
+    v = list->obj->calc2(op);
+    val_destroy(list);
+    return v;
+}
+
+static MUST_CHECK Obj *rcalc2(oper_t op) {
+    Obj *v, *list;
+    if (op->v1->obj == INT_OBJ) {
+        v = calc2_int(op, Range(op->v2), op->v1, true);
+        if (v != NULL) return v;
+    }
+    list = list_from_range(Range(op->v2));
+    op->v2 = list;
+    op->inplace = (list->refcount == 1) ? list : NULL;
+    v = list->obj->rcalc2(op);
+    val_destroy(list);
+    return v;
+}
+
+static MUST_CHECK Obj *slice(oper_t op, argcount_t indx) {
+    Range *v1 = Range(op->v1);
+    Funcargs *args = Funcargs(op->v2);
+    Obj *err, *list, *v;
+    struct indexoffs_s io;
+
+    if (args->len < 1) {
+        return new_error_argnum(args->len, 1, 0, op->epoint2);
+    }
+    io.len = v1->len;
+    io.epoint = &args->val[indx].epoint;
+    io.val = args->val[indx].val;
+
+    if (args->len - 1 <= indx) {
+        if (io.val->obj->iterable) {
+            struct iter_s iter;
+            List *lst;
+            Obj **vals;
+            size_t i;
+            iter.data = io.val; io.val->obj->getiter(&iter);
+
+            if (iter.len == 0) {
+                iter_destroy(&iter);
+                return val_reference(null_list);
+            }
+            lst = new_list();
+            vals = list_create_elements(lst, iter.len);
+            for (i = 0; i < iter.len && (io.val = iter.next(&iter)) != NULL; i++) {
+                err = indexoffs(&io);
+                vals[i] = (err != NULL) ? err : int_from_ival(range_element(v1, (uval_t)io.offs));
+            }
+            lst->len = i;
+            lst->data = vals;
+            iter_destroy(&iter);
+            return Obj(lst);
+        }
+        if (io.val->obj == COLONLIST_OBJ) {
+            struct sliceparam_s s;
+            int64_t step;
+
+            err = sliceparams(&s, &io);
+            if (err != NULL) return err;
+
+            if (s.length == 0) return new_range(0, 1, 0);
+            step = (int64_t)v1->step * s.step;
+            if (s.length == 1 || (step >= INT32_MIN && step <= INT32_MAX)) {
+                return new_range(range_element(v1, (uval_t)s.offset), (s.length == 1) ? 1 : (ival_t)step, s.length);
+            }
+        } else {
+            err = indexoffs(&io);
+            if (err != NULL) return err;
+            return int_from_ival(range_element(v1, (uval_t)io.offs));
+        }
+    }
+    list = list_from_range(v1);
+    op->v1 = list;
+    v = list->obj->slice(op, indx);
+    val_destroy(list);
+    return v;
+}
+
+static MUST_CHECK Obj *contains(oper_t op) {
+    Obj *o1 = op->v1, *v, *list;
+    const Range *v2 = Range(op->v2);
+    if (o1->obj == INT_OBJ) {
+        ival_t iv;
+        bool found = false;
+        Error *err = o1->obj->ival(o1, &iv, 8 * sizeof iv, op->epoint);
+        if (err == NULL) {
+            int64_t d = (int64_t)iv - v2->start;
+            if (v2->len != 0 && d % v2->step == 0) {
+                d /= v2->step;
+                found = d >= 0 && d < (int64_t)v2->len;
+            }
+        } else val_destroy(Obj(err)); /* outside of any range */
+        return truth_reference(found == (op->op == O_IN));
+    }
+    list = list_from_range(v2);
+    op->v2 = list;
+    v = list->obj->contains(op);
+    val_destroy(list);
+    return v;
+}
+
+void rangeobj_init(void) {
+    Type *type = new_type(&obj, T_RANGE, "list", sizeof(Range));
+    type->iterable = true;
+    type->same = same;
+    type->hash = hash;
+    type->repr = repr;
+    type->len = len;
+    type->getiter = getiter;
+    type->getriter = getriter;
+    type->calc1 = calc1;
+    type->calc2 = calc2;
+    type->rcalc2 = rcalc2;
+    type->slice = slice;
+    type->contains = contains;
+}
@@ -0,0 +1,42 @@
+/*
+    $Id$
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+*/
+#ifndef RANGEOBJ_H
+#define RANGEOBJ_H
+#include "obj.h"
+
+extern struct Type *const RANGE_OBJ;
+
+typedef struct Range {
+    Obj v;
+    ival_t start;
+    ival_t step;
+    uval_t len;
+} Range;
+
+#define Range(a) OBJ_CAST(Range, a)
+
+extern void rangeobj_init(void);
+
+static inline ival_t range_element(const Range *v1, uval_t i) {
+    return (ival_t)((uval_t)v1->start + i * (uval_t)v1->step);
+}
+
+extern MUST_CHECK Obj *new_range(ival_t, ival_t, uval_t);
+extern MUST_CHECK Obj *list_from_range(const Range *);
+#endif
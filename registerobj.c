@@ -221,7 +221,7 @@ static MUST_CHECK Obj *rcalc2(oper_t op) {
     return obj_oper_error(op);
 }
 
-static uint32_t register_names;
+uint32_t register_names;
 
 void registerobj_init(void) {
     Type *type = new_type(&obj, T_REGISTER, "register", sizeof(Register));
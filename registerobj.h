@@ -36,6 +36,7 @@ typedef struct Register {
 extern void registerobj_init(void);
 extern void registerobj_names(void);
 extern bool registerobj_createnames(uint32_t);
+extern uint32_t register_names;
 
 static inline Register *ref_register(Register *v1) {
     v1->v.refcount++; return v1;
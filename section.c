@@ -25,6 +25,7 @@
 #include "longjump.h"
 #include "optimizer.h"
 #include "eval.h"
+#include "passtrace.h"
 
 #include "memblocksobj.h"
 #include "mem.h"
@@ -177,8 +178,10 @@ void section_sizecheck(const struct avltree_node *b) {
     do {
         const struct section_s *l = cavltree_container_of(b, struct section_s, node);
         if (l->defpass == pass) {
-            if (l->size != ((!l->address.moved && l->address.end < l->address.address) ? l->address.address : l->address.end) - l->address.start) {
+            address_t size = ((!l->address.moved && l->address.end < l->address.address) ? l->address.address : l->address.end) - l->address.start;
+            if (l->size != size) {
                 if (pass > max_pass) err_msg_cant_calculate2(&l->name, l->file_list, &l->epoint);
+                if (pass_tracing) pass_trace_address2(&l->name, l->file_list, &l->epoint, "size", l->size, size);
                 fixeddig = false;
                 return;
             }
@@ -40,6 +40,90 @@ int str_cmp(const str_t *s1, const str_t *s2) {
     return memcmp(s1->data, s2->data, s1->len);
 }
 
+struct unfkc_node_s {
+    int hash;
+    int mode;
+    str_t name, cfname;
+};
+
+static struct {
+    size_t len, mask;
+    struct unfkc_node_s *data;
+} unfkc_cache;
+
+static void unfkc_cache_destroy(void) {
+    size_t i;
+    if (unfkc_cache.data == NULL) return;
+    for (i = 0; i <= unfkc_cache.mask; i++) {
+        struct unfkc_node_s *n = &unfkc_cache.data[i];
+        if (n->name.data == NULL) continue;
+        free((uint8_t *)n->name.data);
+        free((uint8_t *)n->cfname.data);
+    }
+    free(unfkc_cache.data);
+    unfkc_cache.data = NULL;
+    unfkc_cache.len = 0;
+    unfkc_cache.mask = 0;
+}
+
+static struct unfkc_node_s *unfkc_cache_find(const str_t *name, int hash, int mode) {
+    size_t mask, h, offs;
+    if (unfkc_cache.len * 3 / 2 >= unfkc_cache.mask) {
+        size_t i, max = (unfkc_cache.data == NULL) ? 16 : (unfkc_cache.mask + 1) << 1;
+        struct unfkc_node_s *n;
+        new_array(&n, max);
+        memset(n, 0, max * sizeof *n);
+        mask = max - 1;
+        if (unfkc_cache.data != NULL) {
+            for (i = 0; i <= unfkc_cache.mask; i++) if (unfkc_cache.data[i].name.data != NULL) {
+                h = (size_t)unfkc_cache.data[i].hash;
+                offs = h & mask;
+                while (n[offs].name.data != NULL) {
+                    h >>= 5;
+                    offs = (5 * offs + h + 1) & mask;
+                }
+                n[offs] = unfkc_cache.data[i];
+            }
+            free(unfkc_cache.data);
+        }
+        unfkc_cache.mask = mask;
+        unfkc_cache.data = n;
+    }
+    mask = unfkc_cache.mask;
+    h = (size_t)hash;
+    offs = h & mask;
+    while (unfkc_cache.data[offs].name.data != NULL) {
+        struct unfkc_node_s *d = &unfkc_cache.data[offs];
+        if (d->hash == hash && d->mode == mode && d->name.len == name->len && memcmp(d->name.data, name->data, name->len) == 0) return d;
+        h >>= 5;
+        offs = (5 * offs + h + 1) & mask;
+    }
+    return &unfkc_cache.data[offs];
+}
+
+/* Identifiers are normalized on every reference, so results are kept */
+static MUST_CHECK bool unfkc_cached(str_t *s1, const str_t *s2, int mode) {
+    int hash = str_hash(s2);
+    struct unfkc_node_s *n = unfkc_cache_find(s2, hash, mode);
+    if (n->name.data == NULL) {
+        if (unfkc(s1, s2, mode)) return true;
+        str_cpy(&n->name, s2);
+        str_cpy(&n->cfname, s1);
+        n->hash = hash;
+        n->mode = mode;
+        unfkc_cache.len++;
+        return false;
+    }
+    if (n->cfname.len > s1->len) {
+        uint8_t *s = reallocate_array((uint8_t *)s1->data, n->cfname.len);
+        if (s == NULL) return true;
+        s1->data = s;
+    }
+    s1->len = n->cfname.len;
+    memcpy((uint8_t *)s1->data, n->cfname.data, n->cfname.len);
+    return false;
+}
+
 void str_cfcpy(str_t *s1, const str_t *s2) {
     size_t i, l;
     const uint8_t *d;
@@ -50,7 +134,10 @@ void str_cfcpy(str_t *s1, const str_t *s2) {
                 d = reallocate_array((uint8_t *)s1->data, s1->len);
                 if (d != NULL) s1->data = d;
             }
-        } else free((uint8_t *)cache.data);
+        } else {
+            free((uint8_t *)cache.data);
+            unfkc_cache_destroy();
+        }
         memset(&cache, 0, sizeof cache);
         return;
     }
@@ -58,7 +145,7 @@ void str_cfcpy(str_t *s1, const str_t *s2) {
     if (arguments.caseinsensitive == 0) {
         for (i = 0; i < l; i++) {
             if ((d[i] & 0x80) != 0) {
-                if (unfkc(&cache, s2, 0)) err_msg_out_of_memory();
+                if (unfkc_cached(&cache, s2, 0)) err_msg_out_of_memory();
                 s1->len = cache.len;
                 s1->data = cache.data;
                 return;
@@ -72,7 +159,7 @@ void str_cfcpy(str_t *s1, const str_t *s2) {
         uint8_t *s, ch = d[i];
         if (ch < 'A' || (ch > 'Z' && ch < 0x80)) continue;
         if ((ch & 0x80) != 0) {
-            if (unfkc(&cache, s2, 1)) err_msg_out_of_memory();
+            if (unfkc_cached(&cache, s2, 1)) err_msg_out_of_memory();
             s1->len = cache.len;
             s1->data = cache.data;
             return;
@@ -95,7 +182,7 @@ void str_cfcpy(str_t *s1, const str_t *s2) {
                 continue;
             }
             if ((ch & 0x80) != 0) {
-                if (unfkc(&cache, s2, 1)) err_msg_out_of_memory();
+                if (unfkc_cached(&cache, s2, 1)) err_msg_out_of_memory();
                 s1->len = cache.len;
                 s1->data = cache.data;
                 return;
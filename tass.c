@@ -0,0 +1,279 @@
+/*
+    $Id$
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+*/
+#include "tass.h"
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#if defined _POSIX_C_SOURCE || defined __unix__
+#include <unistd.h>
+#endif
+#include "stdbool.h"
+#include "inttypes.h"
+#include "64tass.h"
+#include "error.h"
+#include "file.h"
+#include "mem.h"
+#include "main.h"
+
+#if _POSIX_VERSION >= 200809L
+#define MEMSTREAM_AVAILABLE
+#endif
+
+#if __has_builtin(__sync_lock_test_and_set)
+#define claim(a) (__sync_lock_test_and_set((a), 1) == 0)
+#define release(a) __sync_lock_release(a)
+#else
+#define claim(a) (*(a) == 0 && (*(a) = 1) != 0)
+#define release(a) (*(a) = 0)
+#endif
+
+struct capture_s {
+    FILE *f;
+    char *data;
+    size_t len;
+};
+
+struct tass_s {
+    char **options;
+    size_t options_len, options_p;
+    char **inputs;
+    size_t inputs_len, inputs_p;
+    struct file_buffer_s *buffers;
+    struct capture_s output;
+    struct capture_s messages;
+};
+
+static char *copy_string(const char *s, size_t len) {
+    char *d;
+    if (inc_overflow(&len, 1)) return NULL;
+    d = allocate_array(char, len);
+    if (d == NULL) return NULL;
+    memcpy(d, s, len - 1);
+    d[len - 1] = 0;
+    return d;
+}
+
+static bool push_string(char ***array, size_t *len, size_t *p, const char *s) {
+    char *d;
+    if (*p >= *len) {
+        char **a;
+        size_t len2 = *len;
+        if (inc_overflow(&len2, 8)) return true;
+        a = reallocate_array(*array, len2);
+        if (a == NULL) return true;
+        *array = a;
+        *len = len2;
+    }
+    d = copy_string(s, strlen(s));
+    if (d == NULL) return true;
+    (*array)[(*p)++] = d;
+    return false;
+}
+
+static void capture_free(struct capture_s *c) {
+    free(c->data);
+    c->data = NULL;
+    c->len = 0;
+}
+
+static bool capture_open(struct capture_s *c) {
+    capture_free(c);
+#ifdef MEMSTREAM_AVAILABLE
+    c->f = open_memstream(&c->data, &c->len);
+#else
+    c->f = tmpfile();
+#endif
+    return c->f == NULL;
+}
+
+static bool capture_close(struct capture_s *c) {
+#ifdef MEMSTREAM_AVAILABLE
+    int err = ferror(c->f);
+    err |= fclose(c->f);
+    c->f = NULL;
+    if (err != 0) capture_free(c);
+    return err != 0;
+#else
+    long int len;
+    int err = fflush(c->f);
+    err |= ferror(c->f);
+    if (err == 0) err = fseek(c->f, 0, SEEK_END);
+    len = (err == 0) ? ftell(c->f) : -1;
+    if (len >= 0 && (unsigned long int)len < SIZE_MAX) {
+        c->data = allocate_array(char, (size_t)len + 1);
+        rewind(c->f);
+        if (c->data != NULL && fread(c->data, 1, (size_t)len, c->f) == (size_t)len) {
+            c->data[len] = 0;
+            c->len = (size_t)len;
+        } else {
+            capture_free(c);
+            err = 1;
+        }
+    } else err = 1;
+    err |= fclose(c->f);
+    c->f = NULL;
+    return err != 0;
+#endif
+}
+
+tass_t *tass_new(void) {
+    tass_t *tass = allocate_array(tass_t, 1);
+    if (tass == NULL) return NULL;
+    tass->options = NULL;
+    tass->options_len = tass->options_p = 0;
+    tass->inputs = NULL;
+    tass->inputs_len = tass->inputs_p = 0;
+    tass->buffers = NULL;
+    tass->output.f = tass->messages.f = NULL;
+    tass->output.data = tass->messages.data = NULL;
+    tass->output.len = tass->messages.len = 0;
+    if (push_string(&tass->options, &tass->options_len, &tass->options_p, "64tass") ||
+        push_string(&tass->options, &tass->options_len, &tass->options_p, "--quiet")) {
+        tass_delete(tass);
+        return NULL;
+    }
+    return tass;
+}
+
+int tass_add_option(tass_t *tass, const char *option) {
+    return push_string(&tass->options, &tass->options_len, &tass->options_p, option) ? -1 : 0;
+}
+
+static int add_buffer(tass_t *tass, const char *name, const void *data, size_t len, bool input) {
+    struct file_buffer_s *b = allocate_array(struct file_buffer_s, 1);
+    char *name2;
+    if (b == NULL) return -1;
+    name2 = copy_string(name, strlen(name));
+    b->data = allocate_array(uint8_t, len != 0 ? len : 1);
+    if (name2 == NULL || b->data == NULL || (input && push_string(&tass->inputs, &tass->inputs_len, &tass->inputs_p, name))) {
+        free(name2);
+        free((uint8_t *)b->data);
+        free(b);
+        return -1;
+    }
+    memcpy((uint8_t *)b->data, data, len);
+    b->name = name2;
+    b->len = len;
+    b->next = tass->buffers;
+    tass->buffers = b;
+    return 0;
+}
+
+int tass_add_source_buffer(tass_t *tass, const char *name, const void *data, size_t len) {
+    return add_buffer(tass, name, data, len, true);
+}
+
+int tass_add_include_buffer(tass_t *tass, const char *name, const void *data, size_t len) {
+    return add_buffer(tass, name, data, len, false);
+}
+
+/* set while an assembly runs, and for good after one was abandoned */
+static int in_use;
+static bool abandoned;
+
+static int run(int *argc, char **argv[]) {
+    jmp_buf abort_jmp;
+    int r;
+    if (setjmp(abort_jmp) != 0) {
+        /* out of memory, the assembler state is lost */
+        error_abort = NULL;
+        abandoned = true;
+        return -1;
+    }
+    error_abort = &abort_jmp;
+    r = main2(argc, argv);
+    error_abort = NULL;
+    return r;
+}
+
+int tass_assemble(tass_t *tass) {
+    char **argv;
+    int argc, i, r;
+    size_t j, len;
+
+    if (add_overflow(tass->options_p, tass->inputs_p, &len) || len > INT_MAX) return -1;
+    if (!claim(&in_use)) return -1;
+    argv = allocate_array(char *, len);
+    if (argv == NULL) {
+        release(&in_use);
+        return -1;
+    }
+    argc = 0;
+    for (j = 0; j < tass->options_p; j++) {
+        argv[argc] = copy_string(tass->options[j], strlen(tass->options[j]));
+        if (argv[argc++] == NULL) break;
+    }
+    for (j = 0; j < tass->inputs_p && argv[argc - 1] != NULL; j++) {
+        argv[argc] = copy_string(tass->inputs[j], strlen(tass->inputs[j]));
+        argc++;
+    }
+    if (argv[argc - 1] == NULL || capture_open(&tass->output)) {
+        release(&in_use);
+        r = -1;
+    } else if (capture_open(&tass->messages)) {
+        capture_close(&tass->output);
+        capture_free(&tass->output);
+        release(&in_use);
+        r = -1;
+    } else {
+        output_stream = tass->output.f;
+        error_stream = tass->messages.f;
+        file_buffers = tass->buffers;
+        signal_received = false;
+        r = run(&argc, &argv);
+        file_buffers = NULL;
+        error_stream = NULL;
+        output_stream = NULL;
+        if (!abandoned) release(&in_use);
+        if (capture_close(&tass->output)) r = -1;
+        if (capture_close(&tass->messages)) r = -1;
+    }
+    for (i = 0; i < argc; i++) free(argv[i]);
+    free(argv);
+    return r;
+}
+
+const unsigned char *tass_get_output(const tass_t *tass, size_t *len) {
+    *len = tass->output.len;
+    return (const unsigned char *)tass->output.data;
+}
+
+const char *tass_get_messages(const tass_t *tass, size_t *len) {
+    *len = tass->messages.len;
+    return tass->messages.data;
+}
+
+void tass_delete(tass_t *tass) {
+    size_t j;
+    if (tass == NULL) return;
+    for (j = 0; j < tass->options_p; j++) free(tass->options[j]);
+    free(tass->options);
+    for (j = 0; j < tass->inputs_p; j++) free(tass->inputs[j]);
+    free(tass->inputs);
+    while (tass->buffers != NULL) {
+        struct file_buffer_s *b = tass->buffers;
+        tass->buffers = b->next;
+        free((char *)b->name);
+        free((uint8_t *)b->data);
+        free(b);
+    }
+    capture_free(&tass->output);
+    capture_free(&tass->messages);
+    free(tass);
+}
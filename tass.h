@@ -0,0 +1,63 @@
+/*
+    $Id$
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+
+*/
+#ifndef TASS_H
+#define TASS_H
+#include <stddef.h>
+
+/*
+   In-process interface of lib64tass.a
+
+   A handle collects command line options and source buffers, then
+   assembles them like the command line tool would. Source buffers are the
+   input files in the order they were added, include buffers are only
+   there for .include and .binary. Both take precedence over files of the
+   same path. The first object output and the messages are kept in memory
+   until the next assembly or until the handle is deleted. Further object
+   outputs, listings, label files and the like are written to their files.
+
+   Functions return 0 on success and -1 on failure. The result of
+   tass_assemble is the exit status of the command line tool instead, or
+   -1 if it could not be started.
+
+   Command line diagnostics, usage and help texts go to the messages as
+   well instead of the standard streams.
+
+   A handle is not an assembler context. The assembler state is process
+   wide, it's set up at the start of tass_assemble and released at its end,
+   so a handle may be assembled again and every assembly starts from the
+   same clean state. Handles may be created and kept in any thread, but
+   only one assembly runs at a time, tass_assemble returns -1 while
+   another one is in progress.
+
+   Running out of memory abandons the assembly with -1 instead of exiting.
+   The assembler state is lost then, all later assemblies return -1.
+*/
+
+typedef struct tass_s tass_t;
+
+extern tass_t *tass_new(void);
+extern int tass_add_option(tass_t *, const char *);
+extern int tass_add_source_buffer(tass_t *, const char *, const void *, size_t);
+extern int tass_add_include_buffer(tass_t *, const char *, const void *, size_t);
+extern int tass_assemble(tass_t *);
+extern const unsigned char *tass_get_output(const tass_t *, size_t *);
+extern const char *tass_get_messages(const tass_t *, size_t *);
+extern void tass_delete(tass_t *);
+
+#endif
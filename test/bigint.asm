@@ -0,0 +1,59 @@
+; Integers around the cutoffs of the long algorithms. With 32 bit digits
+; Karatsuba multiplication starts at 40 digits, recursive division at
+; 60 digit divisors and recursive decimal conversion at 60 digits or at
+; 540 decimal places.
+
+a		.function n
+		.endf (1 << (32 * n - 1)) + 7 ** (11 * n)
+
+b		.function n
+		.endf (1 << (32 * n - 1)) + 3 ** (20 * n)
+
+m		= 1000000007
+		.cerror a(39) * b(39) % m != 975582977
+		.cerror a(40) * b(39) % m != 422090914
+		.cerror a(40) * b(40) % m != 417533463
+		.cerror a(41) * b(41) % m != 965693985
+		.cerror a(40) * b(121) % m != 160880475
+		.cerror a(121) * b(40) % m != 475359270
+		.cerror a(80) * b(80) % m != 48228494
+		.cerror a(40) ** 2 % m != 296397052
+		.cerror a(40) * b(40) != b(40) * a(40)
+
+		.for n, d in [(59, 60), (60, 59), (60, 60), (61, 61), (130, 60), (200, 61)]
+u		:= a(n) * b(d) + b(d) / 3
+		.cerror u / b(d) != a(n) || u % b(d) != b(d) / 3
+		.cerror -u / b(d) != -a(n) - 1 || -u % b(d) != b(d) - b(d) / 3
+		.cerror u / -b(d) != -a(n) - 1 || u % -b(d) != b(d) / 3 - b(d)
+		.cerror -u / -b(d) != a(n) || -u % -b(d) != -(b(d) / 3)
+		.endfor
+
+v		= (b(60) << 1920) - 1
+		.cerror v / b(60) != (1 << 1920) - 1 || v % b(60) != b(60) - 1
+
+		.cerror len(format("%d", a(59))) != 569
+		.cerror format("%d", a(59))[:20] != "11056096430494117248" || format("%d", a(59))[-20:] != "68817399937378616135"
+		.cerror len(format("%d", a(60))) != 578
+		.cerror format("%d", a(60))[:20] != "47485572590394570703" || format("%d", a(60))[-20:] != "73406157153275032289"
+		.cerror len(format("%d", a(61))) != 588
+		.cerror format("%d", a(61))[:20] != "20394898130757868490" || format("%d", a(61))[-20:] != "74818449818423991991"
+		.cerror len(format("%d", a(130))) != 1252
+		.cerror format("%d", a(130))[:20] != "96327872044281093428" || format("%d", a(130))[-20:] != "07349559991665214737"
+
+		.for n in [59, 60, 61, 130]
+		.cerror format("%d", a(n)) != format("%d", a(n) / 10 ** 300) .. format("%0300d", a(n) % 10 ** 300)
+		.cerror format("%d", -a(n)) != "-" .. format("%d", a(n))
+		.endfor
+
+		.cerror 99999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999 != 10 ** 539 - 1
+		.cerror 999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999 != 10 ** 540 - 1
+		.cerror 9999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999999 != 10 ** 541 - 1
+		.cerror 47485572590394570703316641686838245130616105234277665673358176773026141997086614584668481595360427073839433656292953302682584903572816735406551251169208791696223200776931405556592745039732995890405734732068245823846048892256307881561390671818548811880954655684021640458716233218964800882974472928798448852244153341815183213778749100966880258994595558930141117619325005772989487351403828893683715330224683616051685088928625386688481855824034107661764575669056862128758468644080070882617923750236072241433501287625520153924742304038572289375435515563753664987473406157153275032289 != a(60)
+		.cerror -203948981307578684905356500464816626048765204193593446097871609150499159412102367352202281478970358492631021412871642254121672656910309899364838669693919460302167844677045250814636361888346152646174445286285296841744510699463495505726419726081699930917652227203545953934748079946337034384057093196583819195747330252185215293319781293573958644594686561757608488546073908708618017700253898711460104427974869614391982439358996373426817086528556594031707840252424621506030673596550611749752210284956859958416884843384353149602726754004478139091220957447626098893179178935974818449818423991991 != -a(61)
+
+		.cerror -(2 ** 64 - 1) / 2 ** 32 != -4294967296
+		.cerror -(2 ** 64 - 1) % 2 ** 32 != 1
+		.cerror 170141183460469231750134047794974150854 / 9223372040016452775 != 18446744067386197686
+		.cerror 170141183460469231750134047794974150854 % 9223372040016452775 != 1545658406340872204
+		.cerror 170141183539338192537827744999926661121 / 9223372041149743103 != 18446744073670606890
+		.cerror 170141183539338192537827744999926661121 % 9223372041149743103 != 7261485234324881451
@@ -0,0 +1,10 @@
+a		= x"03284d7297bce1062b50759abfe4092e53789dc2e70c31567ba0c5ea0f34597ea3c8ed12375c81a6cbf0153a5f84a9cef3183d6287acd1f61b40658aafd4f91e43688db2d7fc21466b90b5daff24496e93b8dd02274c7196bbe0052a4f7499bee3082d52779cc1e60b30557a9fc4e90e33587da2c7ec11365b80a5caef14395e83a8cdf2173c6186abd0f51a3f6489aed3f81d42678cb1d6fb20456a8fb4d9fe23486d92b7dc01264b7095badf04294e7398bde2072c51769bc0e50a2f54799ec3e80d32577ca1c6eb10355a7fa4c9ee13385d82a7ccf1163b6085aacff4193e6388add2f71c41668bb0d5fa1f44698eb3d8fd22476c91b6db00254a6f94b9de" x 4096
+b		= ~(x"035eb9146fca2580db3691ec47a2fd58b30e69c41f7ad5308be6419cf752ad0863be1974cf2a85e03b96f14ca7025db8136ec9247fda3590eb46a1fc57b20d68c31e79d42f8ae5409bf651ac0762bd1873ce2984df3a95f04ba6015cb7126dc8237ed9348fea45a0fb56b10c67c21d78d32e89e43f9af550ab0661bc1772cd2883de3994ef4aa5005bb6116cc7227dd8338ee9449ffa55b00b66c11c77d22d88e33e99f44faa0560bb1671cc2782dd3893ee49a4ff5ab5106bc6217cd7328de8439ef954af0a65c01b76d12c87e23d98f34ea9045fba1570cb2681dc3792ed48a3fe59b40f6ac5207bd6318ce7429df853ae0964bf1a75d02b86e13c97f24da8" x 4096)
+c		= bits(a)
+d		= bits(b)
+
+		.rept BENCH
+x		:= (a & b) | (a ^ ~b)
+y		:= (c & d) | (c ^ ~d)
+z		:= a .. b
+		.endrept
@@ -0,0 +1,57 @@
+byte		.function n
+		.endf bytes(n + 256)[:1]
+
+pattern		.function n, s
+r		:= x""
+		.for i in range(n)
+r		..= byte((i * s + 3) & 255)
+		.next
+		.endf r
+
+inverted	.function v
+		.endf int(v) < 0
+
+at		.function v, i
+		.endf i < len(v) ? int(v[i]) : (inverted(v) ? 255 : 0)
+
+bytewise	.macro a, b
+		.for i in range((len(\a) > len(\b) ? len(\a) : len(\b)) + 1)
+		.cerror at(\a & \b, i) != (at(\a, i) & at(\b, i))
+		.cerror at(\a | \b, i) != (at(\a, i) | at(\b, i))
+		.cerror at(\a ^ \b, i) != (at(\a, i) ^ at(\b, i))
+		.next
+		.endm
+
+bitwise		.macro a, b
+		.cerror int(bits(\a) & bits(\b)) != (\a & \b)
+		.cerror int(bits(\a) | bits(\b)) != (\a | \b)
+		.cerror int(bits(\a) ^ bits(\b)) != (\a ^ \b)
+		.cerror int(~bits(\a) & bits(\b)) != (~\a & \b)
+		.cerror int(bits(\a) | ~bits(\b)) != (\a | ~\b)
+		.cerror int(~bits(\a) ^ ~bits(\b)) != (~\a ^ ~\b)
+		.cerror int(~bits(\a) & ~bits(\b)) != (~\a & ~\b)
+		.endm
+
+joined		.macro a, b
+c		:= (\a) .. (\b)
+		.cerror len(c) != len(\a) + len(\b)
+		.for i in range(len(c))
+		.cerror int(c[i]) != (i < len(\a) ? at(\a, i) : at(\b, i - len(\a)))
+		.next
+		.endm
+
+lengths		= [0, 1, 7, 8, 9, 16, 17, 33]
+
+		.for la in lengths
+		.for lb in lengths
+a		:= pattern(la, 37)
+b		:= pattern(lb, 91)
+		#bytewise a, b
+		#bytewise ~a, b
+		#bytewise a, ~b
+		#bytewise ~a, ~b
+		#joined a, ~b
+		#joined ~a, b
+		#bitwise (1 << (la * 8)) / 7, (1 << (lb * 8)) / 5
+		.next
+		.next
@@ -0,0 +1,29 @@
+		*= $1000
+Base		= $10
+		.enc "screen"
+		.cdef "az", 1
+
+		.for i in range(4)
+-		.byte base + i, "a"
+		.cerror * - $1000 != i * 2 + 2
+		.cerror (-) != * - 2
+		.cerror int(-) != $1000 + i * 2
+		.next
+
+		.for i in range(4)
+		.if i & 1
+		.cpu "65816"
+		.enc "none"
+		lda 3,s
+		.else
+		.cpu "65c02"
+		.enc "screen"
+		stz $12
+		.endif
+		.cerror (*) != $1008 + i * 6 + 2
+		.cerror "a" != ((i & 1) != 0 ? $41 : 1)
+		.cerror b"a" != ((i & 1) != 0 ? x"41" : x"01")
++		.byte "a", base
+		bra +
++
+		.next
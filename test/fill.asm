@@ -0,0 +1,15 @@
+same		.function a, b
+		.endf len(a) == len(b) && (len(a) == 0 || all(list(a) == b))
+
+		*= $1000
+a		.fill 10, [1, 2, 3]
+		.cerror !same(a, [1, 2, 3, 1, 2, 3, 1, 2, 3, 1])
+b		.fill 7, (1, ?, 3)
+		.cerror !same(b[::3], [1, 1, 1]) || !same(b[2::3], [3, 3])
+		.cerror b[1] != ? || b[4] != ?
+c		.fill 1000, range(300) & 255
+		.cerror !same(c[:300], range(256) .. range(44))
+		.cerror !same(c[300:], c[:700])
+d		.fill 600, (?, ?, 7)
+		.cerror !same(d[2::3], [7] x 200)
+		.cerror d[597] != ? || d[599] != 7
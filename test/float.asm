@@ -0,0 +1,23 @@
+values		= [0.25, 0.5, 1.0, 2.5, 100.0, -0.75, 3]
+positive	= [0.25, 0.5, 1.0, 2.5, 100.0, 7]
+unit		= [-1.0, -0.5, 0.0, 0.5, 1.0]
+
+elementwise	.macro f, l
+		.for i in range(len(\l))
+		.cerror \f(\l)[i] != \f(\l[i])
+		.cerror \f(tuple(\l))[i] != \f(\l[i])
+		.next
+		.endm
+
+		.for f in [exp, sin, cos, tan, atan, cbrt, frac, rad, deg, cosh, sinh, tanh, ceil, floor, round, trunc, abs]
+		#elementwise f, values
+		#elementwise f, range(-3, 5)
+		.next
+		.for f in [sqrt, log10]
+		#elementwise f, positive
+		.next
+		.for f in [acos, asin]
+		#elementwise f, unit
+		.next
+		.cerror type(abs(range(-3, 3))[0]) != int || type(abs([-1.5, 2.0])[0]) != float
+		.cerror sqrt(4.0) != 2.0 || frac(-2.5) != -0.5 || abs(-0.0) != 0.0
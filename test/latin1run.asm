@@ -0,0 +1,42 @@
+; ASCII runs next to 8 bit characters, read as ISO-8859-1
+
+		.cerror len("") != 2
+		.cerror len("axxxxxa") != 9
+		.cerror len("aaxxxxxxxxxxaa") != 16
+		.cerror len("aaaxxxxaaa") != 12
+		.cerror len("aaaaxxxxxxxxxaaaa") != 19
+		.cerror len("aaaaaxxxaaaaa") != 15
+		.cerror len("aaaaaaxxxxxxxxaaaaaa") != 22
+		.cerror len("aaaaaaaxxaaaaaaa") != 18
+		.cerror len("aaaaaaaaxxxxxxxaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaxaaaaaaaaa") != 21
+		.cerror len("aaaaaaaaaaxxxxxxaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaaaaaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaaaaxxxxxaaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaaxxxxxxxxxxaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaxxxxaaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaaxxxxxxxxxaaaaaaaaaaaaaaa") != 41
+		.cerror len("aaaaaaaaaaaaaaaaxxxaaaaaaaaaaaaaaaa") != 37
+		.cerror len("xxxxxxxx") != 10
+		.cerror len("axxa") != 6
+		.cerror len("aaxxxxxxxaa") != 13
+		.cerror len("aaaxaaa") != 9
+		.cerror len("aaaaxxxxxxaaaa") != 16
+		.cerror len("aaaaaaaaaa") != 12
+		.cerror len("aaaaaaxxxxxaaaaaa") != 19
+		.cerror len("aaaaaaaxxxxxxxxxxaaaaaaa") != 26
+		.cerror len("aaaaaaaaxxxxaaaaaaaa") != 22
+		.cerror len("aaaaaaaaaxxxxxxxxxaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaxxxaaaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaaaxxxxxxxxaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaxxaaaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaaaxxxxxxxaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaxaaaaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaaaaxxxxxxaaaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa") != 34
+		.cerror len("xxxxx") != 7
+		.cerror len("axxxxxxxxxxa") != 14
+		.cerror len("aaxxxxaa") != 10
+		.cerror len("aaaxxxxxxxxxaaa") != 17
+		.cerror len("aaaaxxxaaaa") != 13
+		.cerror len("aaaaaxxxxxxxxaaaaa") != 20
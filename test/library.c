@@ -0,0 +1,157 @@
+/*
+    Runs every snippet twice in one process through lib64tass.a and checks
+    that the second assembly gives the same output and messages as the first.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../tass.h"
+
+struct snippet_s {
+    const char *name;
+    const char *option, *option2;
+    int compare;
+    const char *source;
+};
+
+static const struct snippet_s snippets[] = {
+    {"expressions", NULL, NULL, 0,
+        "*= $1000\n"
+        " .rept 2\n"
+        " .byte 1, 2, 5 + 1\n"
+        " .endrept\n"
+        " .byte 1 + 2 * 3, (4, 5)[1], [6, 7][0]\n"},
+    {"syntax error", NULL, NULL, 0,
+        " .byte 1,,2\n"
+        " .byte 1 + {}\n"},
+    {"macros", NULL, NULL, 0,
+        "m1 .macro\n"
+        " .text \"\\a\", '\\2'\n"
+        " .endm\n"
+        " #m1 5,,6\n"
+        " #m1 5,7\n"},
+    {"functions", NULL, NULL, 0,
+        "f .sfunction x, x * 2 + 1\n"
+        " .byte f(1), f(2), f(1)\n"
+        " .byte size(range(3)), range(2, 8, 3)\n"},
+    {"forward references", "--long-branch", NULL, 0,
+        "*= $1000\n"
+        " bne far\n"
+        " .fill 200\n"
+        " lda #<lbl\n"
+        "far rts\n"
+        "lbl = far + 1\n"},
+    {"oscillating branch", "--pass-trace=library.tmp", "--long-branch", 1,
+        "*= $1000\n"
+        " bne lbl\n"
+        " .fill (* > $1002) ? 10 : 200\n"
+        "lbl rts\n"},
+    {"seed file", "--seed-file=library.seed", NULL, 0,
+        "*= $1000\n"
+        " jmp lbl\n"
+        "lbl rts\n"},
+    {"listing", "--list=library.tmp", NULL, 1,
+        "*= $1000\n"
+        "lbl = 3\n"
+        " lda #lbl\n"
+        " rts\n"},
+    {"profile", "--profile=library.tmp", NULL, 0,
+        "m .macro\n"
+        " nop\n"
+        " .endm\n"
+        " #m\n"
+        " #m\n"},
+    {"pass trace", "--pass-trace=library.tmp", NULL, 1,
+        " jmp lbl\n"
+        "lbl rts\n"}
+};
+
+static int assemble(const struct snippet_s *s, tass_t *tass, char **result, size_t *rlen) {
+    const unsigned char *out;
+    const char *msg;
+    size_t olen, mlen, flen = 0;
+    char file[4096];
+    int r;
+    remove("library.tmp");
+    r = tass_assemble(tass);
+    if (r < 0) return -1;
+    if (s->option != NULL && s->compare) {
+        FILE *f = fopen("library.tmp", "rb");
+        if (f == NULL) return -1;
+        flen = fread(file, 1, sizeof file, f);
+        fclose(f);
+    }
+    out = tass_get_output(tass, &olen);
+    msg = tass_get_messages(tass, &mlen);
+    *rlen = olen + mlen + flen;
+    *result = (char *)malloc(*rlen + 1);
+    if (*result == NULL) return -1;
+    if (olen != 0) memcpy(*result, out, olen);
+    if (mlen != 0) memcpy(*result + olen, msg, mlen);
+    if (flen != 0) memcpy(*result + olen + mlen, file, flen);
+    return r;
+}
+
+static tass_t *setup(const struct snippet_s *s) {
+    tass_t *tass = tass_new();
+    if (tass == NULL) return NULL;
+    if (tass_add_option(tass, "-o") < 0 || tass_add_option(tass, "-") < 0 ||
+        (s->option != NULL && tass_add_option(tass, s->option) < 0) ||
+        (s->option2 != NULL && tass_add_option(tass, s->option2) < 0) ||
+        tass_add_source_buffer(tass, "test.asm", s->source, strlen(s->source)) < 0) {
+        tass_delete(tass);
+        return NULL;
+    }
+    return tass;
+}
+
+static int check_messages(const char *option, int expected, const char *text) {
+    struct snippet_s s = {NULL, NULL, NULL, 0, " nop\n"};
+    tass_t *tass;
+    const char *msg;
+    size_t mlen;
+    int r, failed;
+    s.option = option;
+    tass = setup(&s);
+    if (tass == NULL) return 1;
+    r = tass_assemble(tass);
+    msg = tass_get_messages(tass, &mlen);
+    failed = r != expected || mlen < strlen(text) || memcmp(msg, text, strlen(text)) != 0;
+    if (failed) printf("library: %s: unexpected messages\n", option);
+    tass_delete(tass);
+    return failed;
+}
+
+int main(void) {
+    size_t i;
+    int failed = 0;
+    for (i = 0; i < sizeof snippets / sizeof *snippets; i++) {
+        const struct snippet_s *s = &snippets[i];
+        char *first, *second, *third;
+        size_t len1, len2, len3;
+        int r1, r2, r3;
+        tass_t *tass = setup(s), *tass2;
+        if (tass == NULL) return 1;
+        r1 = assemble(s, tass, &first, &len1);
+        r2 = assemble(s, tass, &second, &len2);
+        tass_delete(tass);
+        tass2 = setup(s);
+        if (tass2 == NULL) return 1;
+        r3 = assemble(s, tass2, &third, &len3);
+        tass_delete(tass2);
+        if (r1 < 0 || r1 != r2 || r1 != r3 || len1 != len2 || len1 != len3 ||
+            memcmp(first, second, len1) != 0 || memcmp(first, third, len1) != 0) {
+            printf("library: %s: repeated assembly differs\n", s->name);
+            failed = 1;
+        }
+        free(first);
+        free(second);
+        free(third);
+    }
+    failed |= check_messages("--bogus", 1, "64tass: fatal error: option '--bogus' not recognized\n");
+    failed |= check_messages("-Wbogus", 1, "64tass: fatal error: unrecognized option '-Wbogus'\n");
+    failed |= check_messages("--usage", 0, "Usage: 64tass [-abBCfnTqwWcitxmse?V]");
+    remove("library.tmp");
+    remove("library.seed");
+    return failed;
+}
@@ -0,0 +1,50 @@
+; listing recorded in the converged pass
+
+		.cpu "65816"
+		*= $1000
+start		lda zp		; size known only after the first pass
+		ldx #<table
+		jmp later
+
+m		.macro
+		lda #\1
+		sta \2
+		.endm
+
+		#m 1, $d020
+		#m 2, $d021
+		.proff
+		.byte 1, 2, 3
+		.pron
+		.dpage $1000
+		lda $1010
+		.databank $12
+		lda $123456
+		.al
+		.xs
+		lda #$1234
+		ldx #$12
+		.as
+		.enc "screen"
+		.text "abc"
+		.enc "none"
+		.text "abc"
+		.eor $ff
+		.byte 1
+		lda #1
+		.eor 0
+		.logical $4000
+-		bra -
+		.here
+		.rept 2
+		nop
+		.endrept
+		.if false
+		nop
+		.fi
+		.cpu "6502"
+table		.word start, later
+later		rts
+zp = $12
+		.proff		; left open
+		.byte 0
@@ -0,0 +1,10 @@
+; the logical address differs only in the second pass, no PC column
+
+		*= $1000
+		.logical * + (there - $1004)
+		nop
+		.here
+		lda zp		; absolute in the first pass
+		nop
+there
+zp = $12
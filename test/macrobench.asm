@@ -0,0 +1,18 @@
+; Cost of macro calls for "make bench", with CALL=0 the same
+; instructions are assembled without calling the macro
+
+m		.macro a, b
+		lda #\a
+		sta \b
+		.endm
+
+		.rept 200000
+		.virtual $1000
+		.if CALL
+		#m 1, $d020
+		.else
+		lda #1
+		sta $d020
+		.endif
+		.endv
+		.endrept
@@ -0,0 +1,23 @@
+; a body line shared by macros, only one of which has the named parameter
+define		.segment x, y
+m		.macro \x, \y
+		.byte \{z}, \y
+		.endmacro
+		.endsegment
+
+n1		.block
+		#define z, y
+		.bend
+n2		.block
+		#define x, y
+		.bend
+
+		#n1.m 1, 2
+		#n2.m 1, 2
+		#n1.m 3, 4
+
+m3		.macro a
+		.byte \a, \b, \1
+		.endmacro
+
+		#m3 1
@@ -0,0 +1,50 @@
+		*= $1000
+
+here		.function
+		.endf int(*) - $1000
+
+a1		= here()
+		.byte 0
+a2		= here()
+		.cerror a1 != 0 || a2 != 1
+
+v		.var 1
+get		.function
+		.endf v
+
+b1		= get()
+v		.var 2
+b2		= get()
+		.cerror b1 != 1 || b2 != 2
+
+count		.function
+c		.var 0
+		.for i in range(3)
+c		.var c + i
+		.next
+		.endf c
+
+		.cerror count() != 3 || count() != 3
+
+		.seed 1
+rnd		.function
+		.endf random(1000000)
+
+r1		= rnd()
+r2		= rnd()
+		.cerror r1 == r2
+
+add		.function x
+		.endf x + later
+
+c1		= add(1)
+later		= size(blk)
+c2		= add(1)
+blk		.byte 1, 2, 3
+		.cerror c1 != 4 || c2 != 4
+
+angle		.function y
+		.endf atan2(y, -1.0)
+
+		.cerror angle(0.0) != pi || angle(-0.0) != -pi
+		.cerror angle(-0.0) != -pi || angle(0.0) != pi
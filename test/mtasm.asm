@@ -0,0 +1,13 @@
+; text references are replaced everywhere, also in quoted text
+name		.segment
+l@1		.text "@1@2@3"
+e@1
+		.endm
+
+		*= $1000
+		#name a, "bc", d
+		#name e, "", f
+		.cerror la-$1000
+		.cerror ea-$1004
+		.cerror le-$1004
+		.cerror ee-$1006
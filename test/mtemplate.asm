@@ -0,0 +1,49 @@
+; the same body line is used by two macros with swapped parameter order
+define		.segment x, y
+m		.macro \x, \y=7
+v		= \x * 100 + \y * 10 + \{x}
+		.endmacro
+		.endsegment
+
+n1		.block
+		#define x, y
+		.bend
+n2		.block
+		#define y, x
+		.bend
+
+a1		#n1.m 1, 2
+a2		#n2.m 1, 2
+a3		#n1.m 3, 4
+a4		#n2.m 3
+a5		#n1.m 5
+		.cerror a1.v != 121 || a2.v != 212 || a3.v != 343
+		.cerror a4.v != 737 || a5.v != 575
+
+; all parameters, numbered and named references on one line
+all		.macro first, , third
+v		= [\@]
+w		= [\1, \2, \3, \first, \{third}, \{first}0]
+		.endmacro
+
+b1		#all 1, 2, 3
+		.cerror any(b1.v != [1, 2, 3]) || any(b1.w != [1, 2, 3, 1, 3, 10])
+b2		#all 4,5 , 6
+		.cerror any(b2.v != [4, 5, 6]) || any(b2.w != [4, 5, 6, 4, 6, 40])
+
+; references are not replaced in quoted text and comments
+text		.macro name
+v		= "\name" ; \name
+w		= '\{name}' .. "\@"
+		.endmacro
+
+c1		#text 1
+		.cerror c1.v != "\name" || c1.w != "\{name}\@"
+
+; names which only differ after the first character
+pair		.macro ab, ac
+v		= \ac * 10 + \ab
+		.endmacro
+
+d1		#pair 1, 2
+		.cerror d1.v != 21
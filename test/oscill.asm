@@ -0,0 +1,4 @@
+		*= $1000
+		bne far
+		.fill (* > $1002) ? 100 : 200
+far		rts
@@ -0,0 +1,45 @@
+; overlapping writes in many blocks, the last one written wins
+
+		*= $1000
+		.fill 16, $ee
+		.for i = 0, i < 300, i += 1
+		*= $1000 + (i * 37) % 251
+		.logical $8000 + i * 3
+		.byte (range(i % 23 + 1) + i) & $ff
+		.here
+		.next
+
+		*= $1100		; touching blocks
+		.byte 1, 2, 3
+		.byte 4, 5, 6
+		*= $1103
+		.byte 7
+		*= $1106
+		.byte 8, 9
+
+		*= $1200		; nested inside earlier ones
+		.fill 64, $aa
+		*= $1210
+		.logical $2000
+		.fill 32, $bb
+		.here
+		*= $1218
+		.fill 8, $cc
+		*= $1200
+		.fill 4, $dd
+		*= $123c
+		.fill 8, $11		; sticks out
+		*= $1250
+		.fill 4		; gap
+
+		*= $1180		; section placed over earlier writes
+		.dsection data
+		.section data
+		.byte $55, $56, $57
+		.send
+		*= $1000
+		.section data
+		.byte $58
+		.send
+		*= $1300
+		.byte $99
@@ -0,0 +1,6 @@
+		*= $1000
+		jmp lbl
+		bne far
+		.fill (* > $1006) ? 10 : 200
+far		rts
+lbl		= far + 1
@@ -0,0 +1,10 @@
+m		.macro
+		nop
+		.endm
+f		.function x
+		.endf x * 2
+
+		#m
+		#m
+		#m
+		.byte f(1), f(2), f(1), f(2), f(1)
@@ -0,0 +1,54 @@
+
+same		.function a, b
+		.endf len(a) == len(b) && (len(a) == 0 || all(a == b))
+
+		.cerror !same(range(3), [0, 1, 2])
+		.cerror !same(range(2, 8, 3), [2, 5])
+		.cerror !same(range(5, 0, -2), [5, 3, 1])
+		.cerror !same(range(0), [])
+		.cerror !same(range(3, 3), [])
+		.cerror !same(range(-3), [])
+		.cerror len(range(100)) != 100
+		.cerror len(range(1, 10, 4)) != 3
+
+		.cerror type(range(3)) != list
+		.cerror type(range(0)) != list
+		.cerror repr(type(range(3))) != "<type 'list'>"
+		.cerror format("%d %d", *range(2)) != "0 1"
+
+		.cerror range(10)[3] != 3
+		.cerror range(10)[-1] != 9
+		.cerror !same(range(10)[2:5], [2, 3, 4])
+		.cerror !same(range(10)[::-3], [9, 6, 3, 0])
+		.cerror !same(range(10)[8:2:-2], [8, 6, 4])
+		.cerror !same(range(10)[[1, -2]], [1, 8])
+		.cerror !same(range(10)[5:1], [])
+
+		.cerror !(3 in range(10))
+		.cerror 3 in range(0, 10, 2)
+		.cerror -1 in range(10)
+		.cerror 10 in range(10)
+		.cerror 4 in range(1, 10, 2)
+		.cerror !(5 in range(1, 10, 2))
+
+		.cerror !same(-range(3), [0, -1, -2])
+		.cerror !same(~range(3), [-1, -2, -3])
+		.cerror !same(range(3) + 1, [1, 2, 3])
+		.cerror !same(10 - range(3), [10, 9, 8])
+		.cerror !same(range(3) * 2, [0, 2, 4])
+		.cerror !same(range(3) * 0, [0, 0, 0])
+		.cerror !same(range(3) / 2, [0, 0, 1])
+		.cerror !same(range(3) .. [7], [0, 1, 2, 7])
+		.cerror !same(range(2) x 2, [0, 1, 0, 1])
+		.cerror !same(range(3) + [10, 20, 30], [10, 21, 32])
+		.cerror !same(range($7ffffffd, $7fffffff) * 2, [$fffffffa, $fffffffc])
+		.cerror !same(range($7ffffffd, $7fffffff) + 1, [$7ffffffe, $7fffffff])
+
+s		:= 0
+		.for i in range(1, 5)
+s		:= s + i
+		.endfor
+		.cerror s != 10
+
+		.cerror !same(range(3), list(range(3)))
+		.cerror !same(tuple(range(3)), (0, 1, 2))
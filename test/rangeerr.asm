@@ -0,0 +1,8 @@
+
+r		= range(2, 9, 3)
+		.byte r ? 1 : 0
+		.fill range(3)
+		.byte range(3).a
+		.byte range(3)["a"]
+		.byte r[5]
+		.byte -range(1, 3, 0)
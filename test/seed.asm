@@ -0,0 +1,11 @@
+		*= $1000
+		jmp lbl
+		bne far
+		.fill 200
+far		nop
+lbl		= far + 1
+m		.macro
+		nop
+		.endm
+		#m
+		#m
@@ -0,0 +1,7 @@
+f		.function x
+pi		= x
+		.endf pi
+		.byte f(1)
+		.byte lbl
+		.byte f(1)
+lbl		= 3
@@ -0,0 +1,37 @@
+; Operations on single digit integers take a shortcut, compare them with
+; the results of the multi digit code
+
+wide		= (1 << 64) - 1
+s64		.function v
+		.endf v >= 1 << 63 ? v - (1 << 64) : v
+
+positive	= [0, 1, 2, 127, 128, 254, 255, 256, 257, $7fffffff, $80000000, $fffffffe, $ffffffff]
+values		= positive .. -positive
+
+		.for x in values
+		.for y in values
+		.cerror x & y != s64((x & wide) & (y & wide)), x, y
+		.cerror x | y != s64((x & wide) | (y & wide)), x, y
+		.cerror x ^ y != s64((x & wide) ^ (y & wide)), x, y
+		.cerror x + y != s64((x & wide) + (y & wide) & wide), x, y
+		.cerror x - y != s64((x & wide) + (-y & wide) & wide), x, y
+		.cerror x * y != (x * (y + wide + 1)) - x * (wide + 1), x, y
+v		:= x
+v		&= y
+		.cerror v != x & y, x, y
+v		:= x
+v		|= y
+		.cerror v != x | y, x, y
+v		:= x
+v		^= y
+		.cerror v != x ^ y, x, y
+		.endfor
+		.endfor
+
+		.cerror -2 & -$ffffffff != -4294967296
+		.cerror -$ffffffff & -2 != -4294967296
+		.cerror -1 ^ $ffffffff != -4294967296
+		.cerror -$80000000 - $80000000 != -4294967296
+		.cerror $ffffffff + 1 != 4294967296
+		.cerror -$ffffffff - 1 != -4294967296
+		.cerror 255 + 1 != 256 || 256 - 1 != 255 || 255 | 256 != 511
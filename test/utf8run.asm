@@ -0,0 +1,717 @@
+; ASCII runs next to UTF-8 at every word alignment and across read buffers
+; a combining mark after an ASCII run is composed with the last letter
+
+		.cerror len("é€𝄞é") != 4
+		.cerror len("aé€𝄞xxxxxéa") != 11
+		.cerror len("aaé€𝄞xxxxxxxxxxéaa") != 18
+		.cerror len("aaaé€𝄞xxxxéaaa") != 14
+		.cerror len("aaaaé€𝄞xxxxxxxxxéaaaa") != 21
+		.cerror len("aaaaaé€𝄞xxxéaaaaa") != 17
+		.cerror len("aaaaaaé€𝄞xxxxxxxxéaaaaaa") != 24
+		.cerror len("aaaaaaaé€𝄞xxéaaaaaaa") != 20
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxéaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaé€𝄞xéaaaaaaaaa") != 23
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaé€𝄞éaaaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaaa") != 43
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaaaa") != 39
+		.cerror len("é€𝄞xxxxxxxxé") != 12
+		.cerror len("aé€𝄞xxéa") != 8
+		.cerror len("aaé€𝄞xxxxxxxéaa") != 15
+		.cerror len("aaaé€𝄞xéaaa") != 11
+		.cerror len("aaaaé€𝄞xxxxxxéaaaa") != 18
+		.cerror len("aaaaaé€𝄞éaaaaa") != 14
+		.cerror len("aaaaaaé€𝄞xxxxxéaaaaaa") != 21
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxxxéaaaaaaa") != 28
+		.cerror len("aaaaaaaaé€𝄞xxxxéaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaé€𝄞xxxéaaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaaaa") != 36
+		.cerror len("é€𝄞xxxxxé") != 9
+		.cerror len("aé€𝄞xxxxxxxxxxéa") != 16
+		.cerror len("aaé€𝄞xxxxéaa") != 12
+		.cerror len("aaaé€𝄞xxxxxxxxxéaaa") != 19
+		.cerror len("aaaaé€𝄞xxxéaaaa") != 15
+		.cerror len("aaaaaé€𝄞xxxxxxxxéaaaaa") != 22
+		.cerror len("aaaaaaé€𝄞xxéaaaaaa") != 18
+		.cerror len("aaaaaaaé€𝄞xxxxxxxéaaaaaaa") != 25
+		.cerror len("aaaaaaaaé€𝄞xéaaaaaaaa") != 21
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxéaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaé€𝄞éaaaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaa") != 41
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaaa") != 37
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaaaa") != 44
+		.cerror len("é€𝄞xxé") != 6
+		.cerror len("aé€𝄞xxxxxxxéa") != 13
+		.cerror len("aaé€𝄞xéaa") != 9
+		.cerror len("aaaé€𝄞xxxxxxéaaa") != 16
+		.cerror len("aaaaé€𝄞éaaaa") != 12
+		.cerror len("aaaaaé€𝄞xxxxxéaaaaa") != 19
+		.cerror len("aaaaaaé€𝄞xxxxxxxxxxéaaaaaa") != 26
+		.cerror len("aaaaaaaé€𝄞xxxxéaaaaaaa") != 22
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaé€𝄞xxxéaaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaé€𝄞xxéaaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaaaa") != 41
+		.cerror len("é€𝄞xxxxxxxxxxé") != 14
+		.cerror len("aé€𝄞xxxxéa") != 10
+		.cerror len("aaé€𝄞xxxxxxxxxéaa") != 17
+		.cerror len("aaaé€𝄞xxxéaaa") != 13
+		.cerror len("aaaaé€𝄞xxxxxxxxéaaaa") != 20
+		.cerror len("aaaaaé€𝄞xxéaaaaa") != 16
+		.cerror len("aaaaaaé€𝄞xxxxxxxéaaaaaa") != 23
+		.cerror len("aaaaaaaé€𝄞xéaaaaaaa") != 19
+		.cerror len("aaaaaaaaé€𝄞xxxxxxéaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaé€𝄞éaaaaaaaaa") != 22
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaaa") != 42
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaaaa") != 38
+		.cerror len("é€𝄞xxxxxxxé") != 11
+		.cerror len("aé€𝄞xéa") != 7
+		.cerror len("aaé€𝄞xxxxxxéaa") != 14
+		.cerror len("aaaé€𝄞éaaa") != 10
+		.cerror len("aaaaé€𝄞xxxxxéaaaa") != 17
+		.cerror len("aaaaaé€𝄞xxxxxxxxxxéaaaaa") != 24
+		.cerror len("aaaaaaé€𝄞xxxxéaaaaaa") != 20
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxxéaaaaaaa") != 27
+		.cerror len("aaaaaaaaé€𝄞xxxéaaaaaaaa") != 23
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaé€𝄞xxéaaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaa") != 32
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaaaa") != 46
+		.cerror len("é€𝄞xxxxé") != 8
+		.cerror len("aé€𝄞xxxxxxxxxéa") != 15
+		.cerror len("aaé€𝄞xxxéaa") != 11
+		.cerror len("aaaé€𝄞xxxxxxxxéaaa") != 18
+		.cerror len("aaaaé€𝄞xxéaaaa") != 14
+		.cerror len("aaaaaé€𝄞xxxxxxxéaaaaa") != 21
+		.cerror len("aaaaaaé€𝄞xéaaaaaa") != 17
+		.cerror len("aaaaaaaé€𝄞xxxxxxéaaaaaaa") != 24
+		.cerror len("aaaaaaaaé€𝄞éaaaaaaaa") != 20
+		.cerror len("aaaaaaaaaé€𝄞xxxxxéaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaaaaa") != 43
+		.cerror len("é€𝄞xé") != 5
+		.cerror len("aé€𝄞xxxxxxéa") != 12
+		.cerror len("aaé€𝄞éaa") != 8
+		.cerror len("aaaé€𝄞xxxxxéaaa") != 15
+		.cerror len("aaaaé€𝄞xxxxxxxxxxéaaaa") != 22
+		.cerror len("aaaaaé€𝄞xxxxéaaaaa") != 18
+		.cerror len("aaaaaaé€𝄞xxxxxxxxxéaaaaaa") != 25
+		.cerror len("aaaaaaaé€𝄞xxxéaaaaaaa") != 21
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxéaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaé€𝄞xxéaaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaé€𝄞xéaaaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaaa") != 44
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaaaa") != 40
+		.cerror len("é€𝄞xxxxxxxxxé") != 13
+		.cerror len("aé€𝄞xxxéa") != 9
+		.cerror len("aaé€𝄞xxxxxxxxéaa") != 16
+		.cerror len("aaaé€𝄞xxéaaa") != 12
+		.cerror len("aaaaé€𝄞xxxxxxxéaaaa") != 19
+		.cerror len("aaaaaé€𝄞xéaaaaa") != 15
+		.cerror len("aaaaaaé€𝄞xxxxxxéaaaaaa") != 22
+		.cerror len("aaaaaaaé€𝄞éaaaaaaa") != 18
+		.cerror len("aaaaaaaaé€𝄞xxxxxéaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaé€𝄞xxxxéaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaa") != 38
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaaaa") != 41
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaaaaa") != 37
+		.cerror len("é€𝄞xxxxxxé") != 10
+		.cerror len("aé€𝄞éa") != 6
+		.cerror len("aaé€𝄞xxxxxéaa") != 13
+		.cerror len("aaaé€𝄞xxxxxxxxxxéaaa") != 20
+		.cerror len("aaaaé€𝄞xxxxéaaaa") != 16
+		.cerror len("aaaaaé€𝄞xxxxxxxxxéaaaaa") != 23
+		.cerror len("aaaaaaé€𝄞xxxéaaaaaa") != 19
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxéaaaaaaa") != 26
+		.cerror len("aaaaaaaaé€𝄞xxéaaaaaaaa") != 22
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaé€𝄞xéaaaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaé€𝄞éaaaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaa") != 42
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaaaa") != 45
+		.cerror len("é€𝄞xxxé") != 7
+		.cerror len("aé€𝄞xxxxxxxxéa") != 14
+		.cerror len("aaé€𝄞xxéaa") != 10
+		.cerror len("aaaé€𝄞xxxxxxxéaaa") != 17
+		.cerror len("aaaaé€𝄞xéaaaa") != 13
+		.cerror len("aaaaaé€𝄞xxxxxxéaaaaa") != 20
+		.cerror len("aaaaaaé€𝄞éaaaaaa") != 16
+		.cerror len("aaaaaaaé€𝄞xxxxxéaaaaaaa") != 23
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaé€𝄞xxxxéaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaaaa") != 42
+		.cerror len("é€𝄞é") != 4
+		.cerror len("aé€𝄞xxxxxéa") != 11
+		.cerror len("aaé€𝄞xxxxxxxxxxéaa") != 18
+		.cerror len("aaaé€𝄞xxxxéaaa") != 14
+		.cerror len("aaaaé€𝄞xxxxxxxxxéaaaa") != 21
+		.cerror len("aaaaaé€𝄞xxxéaaaaa") != 17
+		.cerror len("aaaaaaé€𝄞xxxxxxxxéaaaaaa") != 24
+		.cerror len("aaaaaaaé€𝄞xxéaaaaaaa") != 20
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxéaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaé€𝄞xéaaaaaaaaa") != 23
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaé€𝄞éaaaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaa") != 33
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaaa") != 43
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaaaa") != 39
+		.cerror len("é€𝄞xxxxxxxxé") != 12
+		.cerror len("aé€𝄞xxéa") != 8
+		.cerror len("aaé€𝄞xxxxxxxéaa") != 15
+		.cerror len("aaaé€𝄞xéaaa") != 11
+		.cerror len("aaaaé€𝄞xxxxxxéaaaa") != 18
+		.cerror len("aaaaaé€𝄞éaaaaa") != 14
+		.cerror len("aaaaaaé€𝄞xxxxxéaaaaaa") != 21
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxxxéaaaaaaa") != 28
+		.cerror len("aaaaaaaaé€𝄞xxxxéaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaé€𝄞xxxéaaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaaaa") != 36
+		.cerror len("é€𝄞xxxxxé") != 9
+		.cerror len("aé€𝄞xxxxxxxxxxéa") != 16
+		.cerror len("aaé€𝄞xxxxéaa") != 12
+		.cerror len("aaaé€𝄞xxxxxxxxxéaaa") != 19
+		.cerror len("aaaaé€𝄞xxxéaaaa") != 15
+		.cerror len("aaaaaé€𝄞xxxxxxxxéaaaaa") != 22
+		.cerror len("aaaaaaé€𝄞xxéaaaaaa") != 18
+		.cerror len("aaaaaaaé€𝄞xxxxxxxéaaaaaaa") != 25
+		.cerror len("aaaaaaaaé€𝄞xéaaaaaaaa") != 21
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxéaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaé€𝄞éaaaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaa") != 41
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaaaa") != 44
+		.cerror len("é€𝄞xxé") != 6
+		.cerror len("aé€𝄞xxxxxxxéa") != 13
+		.cerror len("aaé€𝄞xéaa") != 9
+		.cerror len("aaaé€𝄞xxxxxxéaaa") != 16
+		.cerror len("aaaaé€𝄞éaaaa") != 12
+		.cerror len("aaaaaé€𝄞xxxxxéaaaaa") != 19
+		.cerror len("aaaaaaé€𝄞xxxxxxxxxxéaaaaaa") != 26
+		.cerror len("aaaaaaaé€𝄞xxxxéaaaaaaa") != 22
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaé€𝄞xxxéaaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaé€𝄞xxéaaaaaaaaaaa") != 28
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaaaa") != 41
+		.cerror len("é€𝄞xxxxxxxxxxé") != 14
+		.cerror len("aé€𝄞xxxxéa") != 10
+		.cerror len("aaé€𝄞xxxxxxxxxéaa") != 17
+		.cerror len("aaaé€𝄞xxxéaaa") != 13
+		.cerror len("aaaaé€𝄞xxxxxxxxéaaaa") != 20
+		.cerror len("aaaaaé€𝄞xxéaaaaa") != 16
+		.cerror len("aaaaaaé€𝄞xxxxxxxéaaaaaa") != 23
+		.cerror len("aaaaaaaé€𝄞xéaaaaaaa") != 19
+		.cerror len("aaaaaaaaé€𝄞xxxxxxéaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaé€𝄞éaaaaaaaaa") != 22
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaaa") != 42
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaaaa") != 38
+		.cerror len("é€𝄞xxxxxxxé") != 11
+		.cerror len("aé€𝄞xéa") != 7
+		.cerror len("aaé€𝄞xxxxxxéaa") != 14
+		.cerror len("aaaé€𝄞éaaa") != 10
+		.cerror len("aaaaé€𝄞xxxxxéaaaa") != 17
+		.cerror len("aaaaaé€𝄞xxxxxxxxxxéaaaaa") != 24
+		.cerror len("aaaaaaé€𝄞xxxxéaaaaaa") != 20
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxxéaaaaaaa") != 27
+		.cerror len("aaaaaaaaé€𝄞xxxéaaaaaaaa") != 23
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaé€𝄞xxéaaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaaaa") != 46
+		.cerror len("é€𝄞xxxxé") != 8
+		.cerror len("aé€𝄞xxxxxxxxxéa") != 15
+		.cerror len("aaé€𝄞xxxéaa") != 11
+		.cerror len("aaaé€𝄞xxxxxxxxéaaa") != 18
+		.cerror len("aaaaé€𝄞xxéaaaa") != 14
+		.cerror len("aaaaaé€𝄞xxxxxxxéaaaaa") != 21
+		.cerror len("aaaaaaé€𝄞xéaaaaaa") != 17
+		.cerror len("aaaaaaaé€𝄞xxxxxxéaaaaaaa") != 24
+		.cerror len("aaaaaaaaé€𝄞éaaaaaaaa") != 20
+		.cerror len("aaaaaaaaaé€𝄞xxxxxéaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaa") != 34
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaaaaa") != 43
+		.cerror len("é€𝄞xé") != 5
+		.cerror len("aé€𝄞xxxxxxéa") != 12
+		.cerror len("aaé€𝄞éaa") != 8
+		.cerror len("aaaé€𝄞xxxxxéaaa") != 15
+		.cerror len("aaaaé€𝄞xxxxxxxxxxéaaaa") != 22
+		.cerror len("aaaaaé€𝄞xxxxéaaaaa") != 18
+		.cerror len("aaaaaaé€𝄞xxxxxxxxxéaaaaaa") != 25
+		.cerror len("aaaaaaaé€𝄞xxxéaaaaaaa") != 21
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxéaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaé€𝄞xxéaaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaé€𝄞xéaaaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaaa") != 44
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaaaa") != 40
+		.cerror len("é€𝄞xxxxxxxxxé") != 13
+		.cerror len("aé€𝄞xxxéa") != 9
+		.cerror len("aaé€𝄞xxxxxxxxéaa") != 16
+		.cerror len("aaaé€𝄞xxéaaa") != 12
+		.cerror len("aaaaé€𝄞xxxxxxxéaaaa") != 19
+		.cerror len("aaaaaé€𝄞xéaaaaa") != 15
+		.cerror len("aaaaaaé€𝄞xxxxxxéaaaaaa") != 22
+		.cerror len("aaaaaaaé€𝄞éaaaaaaa") != 18
+		.cerror len("aaaaaaaaé€𝄞xxxxxéaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaé€𝄞xxxxéaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaaaa") != 41
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaaaaa") != 37
+		.cerror len("é€𝄞xxxxxxé") != 10
+		.cerror len("aé€𝄞éa") != 6
+		.cerror len("aaé€𝄞xxxxxéaa") != 13
+		.cerror len("aaaé€𝄞xxxxxxxxxxéaaa") != 20
+		.cerror len("aaaaé€𝄞xxxxéaaaa") != 16
+		.cerror len("aaaaaé€𝄞xxxxxxxxxéaaaaa") != 23
+		.cerror len("aaaaaaé€𝄞xxxéaaaaaa") != 19
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxéaaaaaaa") != 26
+		.cerror len("aaaaaaaaé€𝄞xxéaaaaaaaa") != 22
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaa") != 29
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaaaaaé€𝄞xéaaaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaé€𝄞éaaaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaa") != 42
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaaaa") != 45
+		.cerror len("é€𝄞xxxé") != 7
+		.cerror len("aé€𝄞xxxxxxxxéa") != 14
+		.cerror len("aaé€𝄞xxéaa") != 10
+		.cerror len("aaaé€𝄞xxxxxxxéaaa") != 17
+		.cerror len("aaaaé€𝄞xéaaaa") != 13
+		.cerror len("aaaaaé€𝄞xxxxxxéaaaaa") != 20
+		.cerror len("aaaaaaé€𝄞éaaaaaa") != 16
+		.cerror len("aaaaaaaé€𝄞xxxxxéaaaaaaa") != 23
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaé€𝄞xxxxéaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaaaa") != 42
+		.cerror len("é€𝄞é") != 4
+		.cerror len("aé€𝄞xxxxxéa") != 11
+		.cerror len("aaé€𝄞xxxxxxxxxxéaa") != 18
+		.cerror len("aaaé€𝄞xxxxéaaa") != 14
+		.cerror len("aaaaé€𝄞xxxxxxxxxéaaaa") != 21
+		.cerror len("aaaaaé€𝄞xxxéaaaaa") != 17
+		.cerror len("aaaaaaé€𝄞xxxxxxxxéaaaaaa") != 24
+		.cerror len("aaaaaaaé€𝄞xxéaaaaaaa") != 20
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxéaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaé€𝄞xéaaaaaaaaa") != 23
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaé€𝄞éaaaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaaa") != 43
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaaaa") != 39
+		.cerror len("é€𝄞xxxxxxxxé") != 12
+		.cerror len("aé€𝄞xxéa") != 8
+		.cerror len("aaé€𝄞xxxxxxxéaa") != 15
+		.cerror len("aaaé€𝄞xéaaa") != 11
+		.cerror len("aaaaé€𝄞xxxxxxéaaaa") != 18
+		.cerror len("aaaaaé€𝄞éaaaaa") != 14
+		.cerror len("aaaaaaé€𝄞xxxxxéaaaaaa") != 21
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxxxéaaaaaaa") != 28
+		.cerror len("aaaaaaaaé€𝄞xxxxéaaaaaaaa") != 24
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaé€𝄞xxxéaaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaaaa") != 36
+		.cerror len("é€𝄞xxxxxé") != 9
+		.cerror len("aé€𝄞xxxxxxxxxxéa") != 16
+		.cerror len("aaé€𝄞xxxxéaa") != 12
+		.cerror len("aaaé€𝄞xxxxxxxxxéaaa") != 19
+		.cerror len("aaaaé€𝄞xxxéaaaa") != 15
+		.cerror len("aaaaaé€𝄞xxxxxxxxéaaaaa") != 22
+		.cerror len("aaaaaaé€𝄞xxéaaaaaa") != 18
+		.cerror len("aaaaaaaé€𝄞xxxxxxxéaaaaaaa") != 25
+		.cerror len("aaaaaaaaé€𝄞xéaaaaaaaa") != 21
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxéaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaé€𝄞éaaaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaa") != 41
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaaaa") != 44
+		.cerror len("é€𝄞xxé") != 6
+		.cerror len("aé€𝄞xxxxxxxéa") != 13
+		.cerror len("aaé€𝄞xéaa") != 9
+		.cerror len("aaaé€𝄞xxxxxxéaaa") != 16
+		.cerror len("aaaaé€𝄞éaaaa") != 12
+		.cerror len("aaaaaé€𝄞xxxxxéaaaaa") != 19
+		.cerror len("aaaaaaé€𝄞xxxxxxxxxxéaaaaaa") != 26
+		.cerror len("aaaaaaaé€𝄞xxxxéaaaaaaa") != 22
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaé€𝄞xxxéaaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaé€𝄞xxéaaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaaaa") != 41
+		.cerror len("é€𝄞xxxxxxxxxxé") != 14
+		.cerror len("aé€𝄞xxxxéa") != 10
+		.cerror len("aaé€𝄞xxxxxxxxxéaa") != 17
+		.cerror len("aaaé€𝄞xxxéaaa") != 13
+		.cerror len("aaaaé€𝄞xxxxxxxxéaaaa") != 20
+		.cerror len("aaaaaé€𝄞xxéaaaaa") != 16
+		.cerror len("aaaaaaé€𝄞xxxxxxxéaaaaaa") != 23
+		.cerror len("aaaaaaaé€𝄞xéaaaaaaa") != 19
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaaaé€𝄞xxxxxxéaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaé€𝄞éaaaaaaaaa") != 22
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaaa") != 42
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaaaa") != 38
+		.cerror len("é€𝄞xxxxxxxé") != 11
+		.cerror len("aé€𝄞xéa") != 7
+		.cerror len("aaé€𝄞xxxxxxéaa") != 14
+		.cerror len("aaaé€𝄞éaaa") != 10
+		.cerror len("aaaaé€𝄞xxxxxéaaaa") != 17
+		.cerror len("aaaaaé€𝄞xxxxxxxxxxéaaaaa") != 24
+		.cerror len("aaaaaaé€𝄞xxxxéaaaaaa") != 20
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxxéaaaaaaa") != 27
+		.cerror len("aaaaaaaaé€𝄞xxxéaaaaaaaa") != 23
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaé€𝄞xxéaaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaaaa") != 46
+		.cerror len("é€𝄞xxxxé") != 8
+		.cerror len("aé€𝄞xxxxxxxxxéa") != 15
+		.cerror len("aaé€𝄞xxxéaa") != 11
+		.cerror len("aaaé€𝄞xxxxxxxxéaaa") != 18
+		.cerror len("aaaaé€𝄞xxéaaaa") != 14
+		.cerror len("aaaaaé€𝄞xxxxxxxéaaaaa") != 21
+		.cerror len("aaaaaaé€𝄞xéaaaaaa") != 17
+		.cerror len("aaaaaaaé€𝄞xxxxxxéaaaaaaa") != 24
+		.cerror len("aaaaaaaaé€𝄞éaaaaaaaa") != 20
+		.cerror len("aaaaaaaaaé€𝄞xxxxxéaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaaaaa") != 43
+		.cerror len("é€𝄞xé") != 5
+		.cerror len("aé€𝄞xxxxxxéa") != 12
+		.cerror len("aaé€𝄞éaa") != 8
+		.cerror len("aaaé€𝄞xxxxxéaaa") != 15
+		.cerror len("aaaaé€𝄞xxxxxxxxxxéaaaa") != 22
+		.cerror len("aaaaaé€𝄞xxxxéaaaaa") != 18
+		.cerror len("aaaaaaé€𝄞xxxxxxxxxéaaaaaa") != 25
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaaé€𝄞xxxéaaaaaaa") != 21
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxéaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaé€𝄞xxéaaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaé€𝄞xéaaaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaaa") != 44
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaaaa") != 40
+		.cerror len("é€𝄞xxxxxxxxxé") != 13
+		.cerror len("aé€𝄞xxxéa") != 9
+		.cerror len("aaé€𝄞xxxxxxxxéaa") != 16
+		.cerror len("aaaé€𝄞xxéaaa") != 12
+		.cerror len("aaaaé€𝄞xxxxxxxéaaaa") != 19
+		.cerror len("aaaaaé€𝄞xéaaaaa") != 15
+		.cerror len("aaaaaaé€𝄞xxxxxxéaaaaaa") != 22
+		.cerror len("aaaaaaaé€𝄞éaaaaaaa") != 18
+		.cerror len("aaaaaaaaé€𝄞xxxxxéaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaé€𝄞xxxxéaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaaaa") != 41
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaaaaa") != 37
+		.cerror len("é€𝄞xxxxxxé") != 10
+		.cerror len("aé€𝄞éa") != 6
+		.cerror len("aaé€𝄞xxxxxéaa") != 13
+		.cerror len("aaaé€𝄞xxxxxxxxxxéaaa") != 20
+		.cerror len("aaaaé€𝄞xxxxéaaaa") != 16
+		.cerror len("aaaaaé€𝄞xxxxxxxxxéaaaaa") != 23
+		.cerror len("aaaaaaé€𝄞xxxéaaaaaa") != 19
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxéaaaaaaa") != 26
+		.cerror len("aaaaaaaaé€𝄞xxéaaaaaaaa") != 22
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaé€𝄞xéaaaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaé€𝄞éaaaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaa") != 42
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaaaa") != 45
+		.cerror len("é€𝄞xxxé") != 7
+		.cerror len("aé€𝄞xxxxxxxxéa") != 14
+		.cerror len("aaé€𝄞xxéaa") != 10
+		.cerror len("aaaé€𝄞xxxxxxxéaaa") != 17
+		.cerror len("aaaaé€𝄞xéaaaa") != 13
+		.cerror len("aaaaaé€𝄞xxxxxxéaaaaa") != 20
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaaé€𝄞éaaaaaa") != 16
+		.cerror len("aaaaaaaé€𝄞xxxxxéaaaaaaa") != 23
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaé€𝄞xxxxéaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaaaa") != 42
+		.cerror len("é€𝄞é") != 4
+		.cerror len("aé€𝄞xxxxxéa") != 11
+		.cerror len("aaé€𝄞xxxxxxxxxxéaa") != 18
+		.cerror len("aaaé€𝄞xxxxéaaa") != 14
+		.cerror len("aaaaé€𝄞xxxxxxxxxéaaaa") != 21
+		.cerror len("aaaaaé€𝄞xxxéaaaaa") != 17
+		.cerror len("aaaaaaé€𝄞xxxxxxxxéaaaaaa") != 24
+		.cerror len("aaaaaaaé€𝄞xxéaaaaaaa") != 20
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxéaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaé€𝄞xéaaaaaaaaa") != 23
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaé€𝄞éaaaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaaa") != 43
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaaaa") != 39
+		.cerror len("é€𝄞xxxxxxxxé") != 12
+		.cerror len("aé€𝄞xxéa") != 8
+		.cerror len("aaé€𝄞xxxxxxxéaa") != 15
+		.cerror len("aaaé€𝄞xéaaa") != 11
+		.cerror len("aaaaé€𝄞xxxxxxéaaaa") != 18
+		.cerror len("aaaaaé€𝄞éaaaaa") != 14
+		.cerror len("aaaaaaé€𝄞xxxxxéaaaaaa") != 21
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxxxéaaaaaaa") != 28
+		.cerror len("aaaaaaaaé€𝄞xxxxéaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaé€𝄞xxxéaaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaaaa") != 36
+		.cerror len("é€𝄞xxxxxé") != 9
+		.cerror len("aé€𝄞xxxxxxxxxxéa") != 16
+		.cerror len("aaé€𝄞xxxxéaa") != 12
+		.cerror len("aaaé€𝄞xxxxxxxxxéaaa") != 19
+		.cerror len("aaaaé€𝄞xxxéaaaa") != 15
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaaé€𝄞xxxxxxxxéaaaaa") != 22
+		.cerror len("aaaaaaé€𝄞xxéaaaaaa") != 18
+		.cerror len("aaaaaaaé€𝄞xxxxxxxéaaaaaaa") != 25
+		.cerror len("aaaaaaaaé€𝄞xéaaaaaaaa") != 21
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxéaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaé€𝄞éaaaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaaa") != 41
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaaaa") != 44
+		.cerror len("é€𝄞xxé") != 6
+		.cerror len("aé€𝄞xxxxxxxéa") != 13
+		.cerror len("aaé€𝄞xéaa") != 9
+		.cerror len("aaaé€𝄞xxxxxxéaaa") != 16
+		.cerror len("aaaaé€𝄞éaaaa") != 12
+		.cerror len("aaaaaé€𝄞xxxxxéaaaaa") != 19
+		.cerror len("aaaaaaé€𝄞xxxxxxxxxxéaaaaaa") != 26
+		.cerror len("aaaaaaaé€𝄞xxxxéaaaaaaa") != 22
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaé€𝄞xxxéaaaaaaaaa") != 25
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaé€𝄞xxéaaaaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaaa") != 38
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaaaa") != 41
+		.cerror len("é€𝄞xxxxxxxxxxé") != 14
+		.cerror len("aé€𝄞xxxxéa") != 10
+		.cerror len("aaé€𝄞xxxxxxxxxéaa") != 17
+		.cerror len("aaaé€𝄞xxxéaaa") != 13
+		.cerror len("aaaaé€𝄞xxxxxxxxéaaaa") != 20
+		.cerror len("aaaaaé€𝄞xxéaaaaa") != 16
+		.cerror len("aaaaaaé€𝄞xxxxxxxéaaaaaa") != 23
+		.cerror len("aaaaaaaé€𝄞xéaaaaaaa") != 19
+		.cerror len("aaaaaaaaé€𝄞xxxxxxéaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaé€𝄞éaaaaaaaaa") != 22
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaaa") != 35
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaaa") != 42
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaaaa") != 38
+		.cerror len("é€𝄞xxxxxxxé") != 11
+		.cerror len("aé€𝄞xéa") != 7
+		.cerror len("aaé€𝄞xxxxxxéaa") != 14
+		.cerror len("aaaé€𝄞éaaa") != 10
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
+		.cerror len("aaaaé€𝄞xxxxxéaaaa") != 17
+		.cerror len("aaaaaé€𝄞xxxxxxxxxxéaaaaa") != 24
+		.cerror len("aaaaaaé€𝄞xxxxéaaaaaa") != 20
+		.cerror len("aaaaaaaé€𝄞xxxxxxxxxéaaaaaaa") != 27
+		.cerror len("aaaaaaaaé€𝄞xxxéaaaaaaaa") != 23
+		.cerror len("aaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaé€𝄞xxéaaaaaaaaaa") != 26
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaé€𝄞xéaaaaaaaaaaaa") != 29
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaaa") != 32
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaaa") != 39
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaaaa") != 46
+		.cerror len("é€𝄞xxxxé") != 8
+		.cerror len("aé€𝄞xxxxxxxxxéa") != 15
+		.cerror len("aaé€𝄞xxxéaa") != 11
+		.cerror len("aaaé€𝄞xxxxxxxxéaaa") != 18
+		.cerror len("aaaaé€𝄞xxéaaaa") != 14
+		.cerror len("aaaaaé€𝄞xxxxxxxéaaaaa") != 21
+		.cerror len("aaaaaaé€𝄞xéaaaaaa") != 17
+		.cerror len("aaaaaaaé€𝄞xxxxxxéaaaaaaa") != 24
+		.cerror len("aaaaaaaaé€𝄞éaaaaaaaa") != 20
+		.cerror len("aaaaaaaaaé€𝄞xxxxxéaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxxxxéaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaé€𝄞xxxéaaaaaaaaaaaaa") != 33
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxxxxéaaaaaaaaaaaaaa") != 40
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxéaaaaaaaaaaaaaaa") != 36
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaaaaaaaa") != 43
+		.cerror len("é€𝄞xé") != 5
+		.cerror len("aé€𝄞xxxxxxéa") != 12
+		.cerror len("aaé€𝄞éaa") != 8
+		.cerror len("aaaé€𝄞xxxxxéaaa") != 15
+		.cerror len("aaaaé€𝄞xxxxxxxxxxéaaaa") != 22
+		.cerror len("aaaaaé€𝄞xxxxéaaaaa") != 18
+		.cerror len("aaaaaaé€𝄞xxxxxxxxxéaaaaaa") != 25
+		.cerror len("aaaaaaaé€𝄞xxxéaaaaaaa") != 21
+		.cerror len("aaaaaaaaé€𝄞xxxxxxxxéaaaaaaaa") != 28
+		.cerror len("aaaaaaaaaé€𝄞xxéaaaaaaaaa") != 24
+		.cerror len("aaaaaaaaaaé€𝄞xxxxxxxéaaaaaaaaaa") != 31
+		.cerror len("aaaaaaaaaaaé€𝄞xéaaaaaaaaaaa") != 27
+		.cerror len("aaaaaaaaaaaaé€𝄞xxxxxxéaaaaaaaaaaaa") != 34
+		.cerror len("aaaaaaaaaaaaaé€𝄞éaaaaaaaaaaaaa") != 30
+		.cerror len("aaaaaaaaaaaaaaé€𝄞xxxxxéaaaaaaaaaaaaaa") != 37
+		.cerror len("aaaaaaaaaaaaaaaé€𝄞xxxxxxxxxxéaaaaaaaaaaaaaaa") != 44
+		.cerror len("aaaaaaaaaaaaaaaaé€𝄞xxxxéaaaaaaaaaaaaaaaa") != 40
+		.cerror len("é€𝄞xxxxxxxxxé") != 13
+		.cerror len("aé€𝄞xxxéa") != 9
+		.cerror len("aaé€𝄞xxxxxxxxéaa") != 16
+;bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb
@@ -24,6 +24,7 @@
 #include "strobj.h"
 #include "functionobj.h"
 #include "dictobj.h"
+#include "listobj.h"
 
 static Type obj;
 
@@ -48,6 +49,7 @@ static MUST_CHECK Obj *type_from_obj(Obj *v1, linepos_t UNUSED(epoint)) {
     switch (v1->obj->type) {
     case T_NONE:
     case T_ERROR: return val_reference(v1);
+    case T_RANGE: return val_reference(Obj(LIST_OBJ)); /* just a compact list */
     default: break;
     }
     return val_reference((Obj *)Obj(v1->obj));
@@ -34,7 +34,7 @@ typedef enum Type_types {
     T_SYMBOL, T_ANONSYMBOL, T_ERROR, T_OPER, T_COLONLIST, T_TUPLE, T_LIST,
     T_DICT, T_MACRO, T_SEGMENT, T_UNION, T_STRUCT, T_MFUNC, T_CODE, T_LBL,
     T_DEFAULT, T_REGISTER, T_FUNCTION, T_FUNCARGS, T_TYPE, T_LABEL,
-    T_NAMESPACE, T_MEMBLOCKS, T_FOLD, T_SFUNC, T_ENC, T_ALIGNBLK
+    T_NAMESPACE, T_MEMBLOCKS, T_FOLD, T_SFUNC, T_ENC, T_ALIGNBLK, T_RANGE
 } Type_types;
 
 typedef struct Type {
@@ -38,6 +38,7 @@ typedef struct Slotcoll {
 } Slotcoll;
 
 static Slotcoll *slotcoll[MAXIMUM_TYPE_LENGTH];
+size_t val_allocs;
 
 static void value_free(Obj *val) {
     Slot *slot = (Slot *)val, **c = val->obj->slot;
@@ -72,6 +73,7 @@ static FAST_CALL NO_INLINE Obj *value_alloc(const Type *obj) {
 
 FAST_CALL MUST_CHECK Obj *val_alloc(const Type *obj) {
     Slot *slot = *obj->slot;
+    val_allocs++;
     if (slot == NULL) return value_alloc(obj);
     slot->v.obj = obj;
     *obj->slot = slot->next;
@@ -32,6 +32,7 @@ struct iter_s {
     size_t len;
 };
 
+extern size_t val_allocs;
 extern FAST_CALL MUST_CHECK struct Obj *val_alloc(const struct Type *);
 extern FAST_CALL void val_destroy(struct Obj *);
 extern FAST_CALL void val_replace(struct Obj **, struct Obj *);
@@ -29,6 +29,7 @@
 #include "eval.h"
 #include "section.h"
 #include "version.h"
+#include "macro.h"
 
 #include "boolobj.h"
 #include "floatobj.h"
@@ -50,8 +51,25 @@
 #include "errorobj.h"
 #include "mfuncobj.h"
 #include "symbolobj.h"
+#include "memblocksobj.h"
 
 static Label *lastlb;
+static uint8_t *seed_data;
+Memblocks *seed_memblocks;
+
+struct seed_s {
+    Label *label;
+    Obj *val;
+    bool code;
+    address_t addr, size;
+    ival_t offs;
+    uval_t required, conflicts;
+};
+
+static struct {
+    struct seed_s *data;
+    size_t p, len;
+} seeds;
 
 #define EQUAL_COLUMN 16
 
@@ -284,23 +302,28 @@ static Label *namespace_lookup3(const Namespace *ns, const Label *p) {
     return NULL;
 }
 
-Label *find_label(const str_t *name, Namespace **here) {
-    size_t p = context_stack.p;
-    Label label, *c;
+/* Function results may only be remembered if they depend on nothing but
+   labels defined in the call itself, or on constants fixed for this pass */
+static void label_purity(const Label *l, const Namespace *context) {
+    if (context == current_context && l->defpass == pass) return;
+    function_impure((l->constant && l->defpass == pass) ? PURITY_PASS : PURITY_NONE);
+}
 
-    str_cfcpy(&label.cfname, name);
-    label.hash = str_hash(&label.cfname);
+static Label *find_label_key(const Label *label, Namespace **here) {
+    size_t p = context_stack.p;
+    Label *c;
 
     while (context_stack.bottom < p) {
         Namespace *context = context_stack.stack[--p].normal;
-        Label *key2 = namespace_lookup(context, &label);
+        Label *key2 = namespace_lookup(context, label);
         if (key2 != NULL) {
+            if (in_function) label_purity(key2, context);
             if (here != NULL) *here = context;
             if (!diagnostics.shadow || !fixeddig || constcreated || (here != NULL && *here == context)) {
                 return key2;
             }
             while (context_stack.bottom < p) {
-                Label *key1 = namespace_lookup(context_stack.stack[--p].normal, &label);
+                Label *key1 = namespace_lookup(context_stack.stack[--p].normal, label);
                 if (key1 != NULL) {
                     Obj *o1 = key1->value;
                     Obj *o2 = key2->value;
@@ -310,7 +333,7 @@ Label *find_label(const str_t *name, Namespace **here) {
                     }
                 }
             }
-            c = namespace_lookup2(&label);
+            c = namespace_lookup2(label);
             if (c != NULL) {
                 Obj *o1 = c->value;
                 Obj *o2 = key2->value;
@@ -321,18 +344,43 @@ Label *find_label(const str_t *name, Namespace **here) {
             return key2;
         }
     }
-    c = namespace_lookup2(&label);
+    c = namespace_lookup2(label);
+    if (c == NULL) function_impure(PURITY_NONE);
     if (here != NULL) *here = (c != NULL) ? builtin_namespace : NULL;
     return c;
 }
 
-Label *find_label2(const str_t *name, Namespace *context) {
+Label *find_label(const str_t *name, Namespace **here) {
     Label label;
 
     str_cfcpy(&label.cfname, name);
     label.hash = str_hash(&label.cfname);
 
-    return namespace_lookup(context, &label);
+    return find_label_key(&label, here);
+}
+
+/* Same as find_label, but the name is already folded and hashed */
+Label *find_label_hashed(const str_t *cfname, int hash, Namespace **here) {
+    Label label;
+
+    label.cfname = *cfname;
+    label.hash = hash;
+
+    return find_label_key(&label, here);
+}
+
+Label *find_label2(const str_t *name, Namespace *context) {
+    Label label, *c;
+
+    str_cfcpy(&label.cfname, name);
+    label.hash = str_hash(&label.cfname);
+
+    c = namespace_lookup(context, &label);
+    if (in_function) {
+        if (c != NULL) label_purity(c, context);
+        else function_impure(PURITY_NONE);
+    }
+    return c;
 }
 
 struct anonsymbol_s {
@@ -361,6 +409,7 @@ Label *find_anonlabel(ssize_t count) {
     anonsymbol.pad = 0;
 
     label.cfname.data = (const uint8_t *)&anonsymbol;
+    function_impure(PURITY_NONE);
 
     while (context_stack.bottom < p) {
         uint32_t count2;
@@ -391,6 +440,7 @@ Label *find_anonlabel2(ssize_t count, Namespace *context) {
     uint32_t count2;
     struct anonsymbol_s anonsymbol;
 
+    function_impure(PURITY_NONE);
     if (count < 0) {
         if (context->backr < -(size_t)count) return NULL;
         count2 = context->backr - -(uint32_t)count;
@@ -825,6 +875,324 @@ void ref_labels(void) {
     }
 }
 
+static bool seed_value(Obj *val, char *s) {
+    struct linepos_s nopoint = {0, 0};
+    Error *err;
+    if (val->obj == INT_OBJ) {
+        ival_t iv;
+        err = val->obj->ival(val, &iv, 8 * sizeof iv, &nopoint);
+        if (err != NULL) {
+            val_destroy(Obj(err));
+            return false;
+        }
+        sprintf(s, "#%" PRIdval, iv);
+        return true;
+    }
+    if (val->obj == BITS_OBJ) {
+        uval_t uv;
+        if (Bits(val)->len < 0 || Bits(val)->bits > 8 * sizeof uv) return false;
+        err = val->obj->uval(val, &uv, 8 * sizeof uv, &nopoint);
+        if (err != NULL) {
+            val_destroy(Obj(err));
+            return false;
+        }
+        sprintf(s, "$%" PRIxval ":%u", uv, (unsigned int)Bits(val)->bits);
+        return true;
+    }
+    return false;
+}
+
+static void seedprint(Namespace *names, unsigned int depth, FILE *f) {
+    size_t n, ln;
+
+    if (names->len == 0) return;
+    ln = names->len; names->len = 0;
+    for (n = 0; n <= names->mask; n++) {
+        Label *l = names->data[n];
+        char typ[32];
+        size_t i;
+        if (l == NULL || l->name.data == NULL) continue;
+        if (l->name.len > 1 && l->name.data[1] == 0) continue;
+        if (!l->constant || l->strength != 0 || l->defpass != pass) continue;
+        for (i = 0; i < l->name.len; i++) {
+            if (l->name.data[i] <= 0x20 || l->name.data[i] == '.') break;
+        }
+        if (i != l->name.len || l->name.data[0] == '#') continue;
+        if (l->value->obj == CODE_OBJ) {
+            Code *code = Code(l->value);
+            if (code->pass != code->apass || !seed_value(code->typ, typ)) continue;
+            fprintf(f, "%u c %d %" PRIxaddress " %" PRIxaddress " %" PRIdval " %d %" PRIxval " %" PRIxval " %s ", depth, l->ref, code->addr, code->size, code->offs, code->dtype, code->required, code->conflicts, typ);
+            fwrite(l->name.data, 1, l->name.len, f);
+            putc('\n', f);
+            seedprint(code->names, depth + 1, f);
+        } else if (seed_value(l->value, typ)) {
+            fprintf(f, "%u = %d %s ", depth, l->ref, typ);
+            fwrite(l->name.data, 1, l->name.len, f);
+            putc('\n', f);
+        }
+    }
+    names->len = ln;
+}
+
+/* The last line is a checksum of everything before it */
+static int seed_sign(FILE *f) {
+    long int len;
+    uint8_t *data;
+    str_t s;
+    int err;
+    if (fflush(f) != 0 || fseek(f, 0, SEEK_END) != 0) return 1;
+    len = ftell(f);
+    if (len < 0 || (unsigned long int)len >= SIZE_MAX) return 1;
+    new_array(&data, (size_t)len + 1);
+    rewind(f);
+    s.data = data;
+    s.len = fread(data, 1, (size_t)len, f);
+    err = (s.len != (size_t)len || fseek(f, 0, SEEK_END) != 0);
+    if (err == 0) fprintf(f, "s %x\n", (unsigned int)str_hash(&s));
+    free(data);
+    return err;
+}
+
+void seed_write(const struct seed_file_s *seed) {
+    FILE *f;
+    int err;
+    if (seed->name == NULL) return;
+    f = fopen_utf8(seed->name, "w+b");
+    if (f == NULL) {
+        err_msg_file2(ERROR_CANT_WRTE_SEED, seed->name, &seed->name_pos);
+        return;
+    }
+    clearerr(f); errno = 0;
+    fputs("64tass seed V" VERSION "\n", f);
+    fprintf(f, "r %" PRIx32 "\n", register_names);
+    seedprint(root_namespace, 0, f);
+    err = seed_sign(f);
+    err |= ferror(f);
+    err |= fclose(f);
+    if (err != 0 && errno != 0) err_msg_file2(ERROR_CANT_WRTE_SEED, seed->name, &seed->name_pos);
+}
+
+static Obj *seed_value_parse(char **s) {
+    char *end;
+    if (**s == '#') {
+        long int l = strtol(*s + 1, &end, 10);
+        if (end == *s + 1 || *end != ' ') return NULL;
+        *s = end + 1;
+        return int_from_ival((ival_t)l);
+    }
+    if (**s == '$') {
+        unsigned long int v = strtoul(*s + 1, &end, 16), bits;
+        if (end == *s + 1 || *end != ':') return NULL;
+        bits = strtoul(end + 1, s, 10);
+        if (**s != ' ' || bits > 8 * sizeof(uval_t)) return NULL;
+        *s += 1;
+        return bits_from_uval((uval_t)v, (unsigned int)bits);
+    }
+    return NULL;
+}
+
+static bool seed_number(char **s, long int *l) {
+    char *end;
+    *l = strtol(*s, &end, 10);
+    if (end == *s || *end != ' ') return false;
+    *s = end + 1;
+    return true;
+}
+
+static bool seed_hex(char **s, uval_t *uv) {
+    char *end;
+    *uv = (uval_t)strtoul(*s, &end, 16);
+    if (end == *s || *end != ' ') return false;
+    *s = end + 1;
+    return true;
+}
+
+static void seed_add(Label *label, Obj *val) {
+    struct seed_s *s;
+    if (seeds.p >= seeds.len) extend_array(&seeds.data, &seeds.len, 64);
+    s = &seeds.data[seeds.p++];
+    s->label = ref_label(label);
+    s->code = (val->obj == CODE_OBJ);
+    if (s->code) {
+        const Code *code = Code(val);
+        s->val = val_reference(code->typ);
+        s->addr = code->addr;
+        s->size = code->size;
+        s->offs = code->offs;
+        s->required = code->required;
+        s->conflicts = code->conflicts;
+    } else s->val = val_reference(val);
+}
+
+static void seed_free(void) {
+    while (seeds.p != 0) {
+        struct seed_s *s = &seeds.data[--seeds.p];
+        val_destroy(Obj(s->label));
+        val_destroy(s->val);
+    }
+}
+
+/* Labels of the previous compilation are loaded as if they were defined in
+   pass 1 so that the first real pass can use them for forward references.
+   Changed or damaged files are not used. */
+bool seed_read(const struct seed_file_s *seed) {
+    static const char header[] = "64tass seed V" VERSION "\n";
+    struct linepos_s nopoint = {0, 0};
+    struct {
+        Namespace **data;
+        size_t p, len;
+    } stack;
+    FILE *f;
+    size_t len, max;
+    char *s, *end;
+    unsigned long int regs, sum;
+    str_t text;
+
+    if (seed->name == NULL) return false;
+    f = fopen_utf8(seed->name, "rb");
+    if (f == NULL) return false;
+    len = 0; max = 0;
+    for (;;) {
+        size_t l;
+        if (len + 1 >= max) extend_array(&seed_data, &max, 65536);
+        l = fread(seed_data + len, 1, max - len - 1, f);
+        len += l;
+        if (l == 0) break;
+    }
+    fclose(f);
+    seed_data[len] = 0;
+    if (len < sizeof header - 1 || memcmp(seed_data, header, sizeof header - 1) != 0) return false;
+    if (seed_data[len - 1] != '\n') return false;
+    for (s = (char *)seed_data + len - 1; s[-1] != '\n'; s--) {}
+    if (s[0] != 's' || s[1] != ' ') return false;
+    sum = strtoul(s + 2, &end, 16);
+    if (end == s + 2 || *end != '\n') return false;
+    text.data = seed_data;
+    text.len = (size_t)((uint8_t *)s - seed_data);
+    if (sum != (unsigned int)str_hash(&text)) return false;
+    *s = 0;
+
+    if (seed_memblocks == NULL) seed_memblocks = new_memblocks(0, 0);
+    s = (char *)seed_data + sizeof header - 1;
+    if (s[0] != 'r' || s[1] != ' ') return false;
+    regs = strtoul(s + 2, &end, 16);
+    if (end == s + 2 || *end != '\n') return false;
+    s = end + 1;
+    registerobj_createnames((uint32_t)regs);
+
+    stack.len = 8;
+    new_array(&stack.data, stack.len);
+    stack.data[0] = root_namespace;
+    stack.p = 1;
+    while (*s != 0) {
+        long int depth, ref;
+        char kind;
+        Obj *val;
+        Label *label;
+        str_t name;
+        end = strchr(s, '\n');
+        if (end == NULL) break;
+        *end = 0;
+        if (!seed_number(&s, &depth) || depth < 0 || (size_t)depth >= stack.p) break;
+        kind = *s;
+        if ((kind != 'c' && kind != '=') || s[1] != ' ') break;
+        s += 2;
+        if (!seed_number(&s, &ref)) break;
+        if (kind == 'c') {
+            long int offs, dtype;
+            uval_t addr, size, required, conflicts;
+            Code *code;
+            if (!seed_hex(&s, &addr) || !seed_hex(&s, &size) || !seed_number(&s, &offs) || !seed_number(&s, &dtype)) break;
+            if (!seed_hex(&s, &required) || !seed_hex(&s, &conflicts)) break;
+            val = seed_value_parse(&s);
+            if (val == NULL) break;
+            code = new_code();
+            code->addr = (address_t)addr;
+            code->typ = val;
+            code->size = (address_t)size;
+            code->offs = (ival_t)offs;
+            code->dtype = (signed char)dtype;
+            code->pass = 1;
+            code->apass = 1;
+            code->memblocks = ref_memblocks(seed_memblocks);
+            code->memaddr = 0;
+            code->membp = 0;
+            code->names = new_namespace(dummy_file_list, &nopoint);
+            code->required = required;
+            code->conflicts = conflicts;
+            val = Obj(code);
+        } else {
+            val = seed_value_parse(&s);
+            if (val == NULL) break;
+        }
+        name.data = (const uint8_t *)s;
+        name.len = (size_t)(end - s);
+        s = end + 1;
+        stack.p = (size_t)depth + 1;
+        label = new_label(&name, stack.data[depth], 0, dummy_file_list);
+        if (label->value != NULL || name.len == 0) {
+            val_destroy(val);
+            continue;
+        }
+        label->constant = true;
+        label->owner = (val->obj == CODE_OBJ);
+        label->value = val;
+        label->epoint = nopoint;
+        label->ref = (ref != 0);
+        label->defpass = 1;
+        seed_add(label, val);
+        if (val->obj == CODE_OBJ) {
+            if (stack.p >= stack.len) extend_array(&stack.data, &stack.len, 8);
+            stack.data[stack.p++] = Code(val)->names;
+        }
+    }
+    free(stack.data);
+    return true;
+}
+
+static bool seed_unused(Namespace *names) {
+    size_t n, ln;
+    bool ret = false;
+
+    if (names->len == 0) return false;
+    ln = names->len; names->len = 0;
+    for (n = 0; n <= names->mask && !ret; n++) {
+        Label *l = names->data[n];
+        if (l == NULL) continue;
+        if (l->defpass == 1) ret = true;
+        else if (l->value->obj == CODE_OBJ) ret = seed_unused(Code(l->value)->names);
+    }
+    names->len = ln;
+    return ret;
+}
+
+/* Seeded labels not defined again are left over from the previous build */
+bool seed_stale(void) {
+    return seed_unused(root_namespace);
+}
+
+/* A seeded value used before its definition must be confirmed by it. If it
+   isn't then the pass might have followed a guess which the compilation
+   without a seed would not make, so the result can't be kept. */
+bool seed_check(void) {
+    bool ret = false;
+    size_t i;
+    for (i = 0; i < seeds.p && !ret; i++) {
+        const struct seed_s *s = &seeds.data[i];
+        const Label *l = s->label;
+        if (l->fwpass != pass) continue;
+        if (l->defpass != pass) ret = true;
+        else if (!s->code) ret = !l->value->obj->same(l->value, s->val);
+        else if (l->value->obj != CODE_OBJ) ret = true;
+        else {
+            const Code *code = Code(l->value);
+            ret = code->addr != s->addr || code->size != s->size || code->offs != s->offs || code->required != s->required || code->conflicts != s->conflicts || !code->typ->obj->same(code->typ, s->val);
+        }
+    }
+    seed_free();
+    return ret;
+}
+
 void new_builtin(const char *symbol, Obj *val) {
     struct linepos_s nopoint = {0, 0};
     str_t name;
@@ -892,4 +1260,14 @@ void destroy_variables(void) {
         val_destroy(Obj(c->cheap));
     }
     free(context_stack.stack);
+    seed_free();
+    free(seeds.data);
+    seeds.data = NULL;
+    seeds.len = 0;
+    free(seed_data);
+    seed_data = NULL;
+    if (seed_memblocks != NULL) {
+        val_destroy(Obj(seed_memblocks));
+        seed_memblocks = NULL;
+    }
 }
@@ -26,6 +26,8 @@ struct Label;
 struct Obj;
 struct Mfunc;
 struct symbol_output_s;
+struct seed_file_s;
+struct Memblocks;
 struct file_list_s;
 struct str_t;
 
@@ -41,7 +43,9 @@ extern void context_set_bottom(size_t);
 
 extern struct Namespace *current_context, *cheap_context, *root_namespace;
 extern size_t fwcount;
+extern struct Memblocks *seed_memblocks;
 extern struct Label *find_label(const struct str_t *, struct Namespace **);
+extern struct Label *find_label_hashed(const struct str_t *, int, struct Namespace **);
 extern struct Label *find_label2(const struct str_t *, struct Namespace *);
 extern struct Label *find_label3(const struct str_t *, struct Namespace *, uint8_t);
 extern struct Label *find_anonlabel(ssize_t);
@@ -49,6 +53,10 @@ extern struct Label *find_anonlabel2(ssize_t, struct Namespace *);
 extern struct Label *new_label(const struct str_t *, struct Namespace *, uint8_t, const struct file_list_s *);
 extern void label_move(struct Label *, const struct str_t *, const struct file_list_s *);
 extern void labelprint(const struct symbol_output_s *);
+extern bool seed_read(const struct seed_file_s *);
+extern void seed_write(const struct seed_file_s *);
+extern bool seed_stale(void);
+extern bool seed_check(void);
 extern void unused_check(struct Namespace *);
 extern void ref_labels(void);
 extern void destroy_variables(void);